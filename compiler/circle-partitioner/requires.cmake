@@ -2,5 +2,6 @@ require("foder")
 require("crew")
 require("safemain")
 require("luci")
+require("luci-interpreter")
 require("arser")
 require("vconone")
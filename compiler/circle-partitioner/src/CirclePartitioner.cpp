@@ -16,12 +16,14 @@
 
 #include "PartitionRead.h"
 #include "PartitionExport.h"
+#include "PartitionMeasure.h"
 #include "HelperPath.h"
 #include "HelperStrings.h"
 
 #include <foder/FileLoader.h>
 
 #include <luci/Importer.h>
+#include <luci/PartitionCost.h>
 #include <luci/Service/Validate.h>
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
@@ -38,6 +40,7 @@ namespace
 
 const char *opt_bks = "--backends";
 const char *opt_def = "--default";
+const char *opt_measure = "--measure_runs";
 const char *opt_part = "partition";
 const char *opt_input = "input";
 const char *opt_work = "work";
@@ -69,6 +72,12 @@ void build_arser(arser::Arser &arser)
     .required(false)
     .help("Default backend to assign");
 
+  arser.add_argument(opt_measure)
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .required(false)
+    .help("Assign backends by cost, measured by running the model N times with luci-interpreter");
+
   arser.add_argument(opt_part)
     .nargs(1)
     .type(arser::DataType::STR)
@@ -134,6 +143,14 @@ bool validate_partition(luci::PartitionTable &partition)
       return false;
     }
   }
+  for (auto &byopname : partition.byopnames)
+  {
+    if (!partee::is_one_of(byopname.second, partition.groups))
+    {
+      std::cerr << "OPNAME " << byopname.first << " is not assigned to one of 'backends' items";
+      return false;
+    }
+  }
   return true;
 }
 
@@ -151,6 +168,10 @@ void dump(std::ostream &os, const luci::PartitionTable &table)
   os << "Assign by OPCODE: " << std::endl;
   for (auto &item : table.byopcodes)
     os << "  " << item.first << "=" << item.second << std::endl;
+
+  os << "Assign by OPNAME: " << std::endl;
+  for (auto &item : table.byopnames)
+    os << "  " << item.first << "=" << item.second << std::endl;
 }
 
 std::ostream &operator<<(std::ostream &os, const luci::PartitionTable &table)
@@ -215,6 +236,26 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  // assign by cost, which overrides assignment by OPCODE and OPNAME
+  luci::PartitionCost cost;
+  bool by_cost = partee::read_cost(partition_path, cost);
+  if (arser[opt_measure])
+  {
+    auto runs = arser.get<int32_t>(opt_measure);
+    if (runs < 1)
+    {
+      std::cerr << "ERROR: The number of runs to measure must be positive" << std::endl;
+      return EXIT_FAILURE;
+    }
+    INFO(l) << "--- Measure cost--------------------------------" << std::endl;
+    partee::measure_cost(module.get(), static_cast<uint32_t>(runs), cost);
+    by_cost = true;
+  }
+  if (by_cost)
+  {
+    luci::assign_by_cost(module.get(), cost, partition);
+  }
+
   INFO(l) << "--- PartitionConfig final----------------------" << std::endl;
   INFO(l) << partition << std::endl;
 
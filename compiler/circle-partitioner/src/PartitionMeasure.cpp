@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionMeasure.h"
+
+#include <luci_interpreter/Interpreter.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco.h>
+
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+class OperatorTimer final : public luci_interpreter::ExecutionObserver
+{
+public:
+  void preOperatorExecute(const luci::CircleNode *) override
+  {
+    _begin = std::chrono::steady_clock::now();
+  }
+
+  void postOperatorExecute(const luci::CircleNode *node) override
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - _begin;
+    _times[node->name()] += std::chrono::duration<double, std::micro>(elapsed).count();
+  }
+
+  const std::unordered_map<std::string, double> &times(void) const { return _times; }
+
+private:
+  std::chrono::steady_clock::time_point _begin;
+  std::unordered_map<std::string, double> _times;
+};
+
+template <typename NodeT> size_t tensor_size(const NodeT *node)
+{
+  uint32_t tsize = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (!node->dim(i).known())
+      throw std::runtime_error("Unknown dimension of input '" + node->name() +
+                               "' to measure cost");
+    tsize *= node->dim(i).value();
+  }
+  return tsize;
+}
+
+} // namespace
+
+namespace partee
+{
+
+void measure_cost(const luci::Module *module, uint32_t runs, luci::PartitionCost &cost)
+{
+  assert(module != nullptr);
+  assert(runs > 0);
+
+  LOGGER(l);
+
+  luci_interpreter::Interpreter interpreter(module);
+
+  // NOTE Inputs are zeros, with which data dependent operators may take other time than usual
+  const auto input_nodes = loco::input_nodes(module->graph());
+  for (auto node : input_nodes)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(node);
+    std::vector<char> input_data(tensor_size(input_node));
+    interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
+  }
+
+  // First run is not measured, which allocates memory and warms up caches
+  interpreter.interpret();
+
+  OperatorTimer timer;
+  interpreter.attachObserver(&timer);
+  for (uint32_t r = 0; r < runs; ++r)
+    interpreter.interpret();
+
+  for (auto &time : timer.times())
+  {
+    const auto mean = time.second / runs;
+    INFO(l) << "Measured: " << time.first << ": " << mean << " us" << std::endl;
+    cost.byopnames[time.first] = mean;
+  }
+}
+
+} // namespace partee
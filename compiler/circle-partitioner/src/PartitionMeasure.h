@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_MEASURE_H__
+#define __CIRCLE_PARTITION_MEASURE_H__
+
+#include <luci/IR/Module.h>
+#include <luci/PartitionCost.h>
+
+#include <cstdint>
+
+namespace partee
+{
+
+/**
+ * @brief Runs module with luci-interpreter and sets mean time of each operator in microseconds
+ *        to cost by OP name
+ */
+void measure_cost(const luci::Module *module, uint32_t runs, luci::PartitionCost &cost);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_MEASURE_H__
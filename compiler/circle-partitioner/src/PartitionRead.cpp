@@ -30,11 +30,18 @@ using namespace partee;
 
 const char *_section_partition = "partition";
 const char *_section_OPCODE = "OPCODE";
+const char *_section_OPNAME = "OPNAME";
+const char *_section_OPCODE_COST = "OPCODE_COST";
+const char *_section_OPNAME_COST = "OPNAME_COST";
 
 const char *_key_backends = "backends";
 const char *_key_default = "default";
+const char *_key_comply = "comply";
+const char *_key_transfer_cost = "transfer_cost";
 const char *_key_underscore = "_";
 
+const char *_comply_cost = "cost";
+
 luci::PartitionTable parse_table(const crew::Sections &sections)
 {
   luci::PartitionTable table;
@@ -70,11 +77,65 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
         }
       }
     }
+    else if (section.name == _section_OPNAME)
+    {
+      for (auto &item : section.items)
+        table.byopnames.emplace(item.first, item.second);
+    }
   }
 
   return table;
 }
 
+double to_cost(const std::string &key, const std::string &value)
+{
+  try
+  {
+    return std::stod(value);
+  }
+  catch (const std::exception &)
+  {
+    throw std::invalid_argument("Invalid cost of '" + key + "': " + value);
+  }
+}
+
+bool parse_cost(const crew::Sections &sections, luci::PartitionCost &cost)
+{
+  bool by_cost = false;
+
+  for (auto &section : sections)
+  {
+    if (section.name == _section_partition)
+    {
+      auto &items = section.items;
+      auto it = items.find(_key_comply);
+      if (it != items.end())
+        by_cost = it->second == _comply_cost;
+
+      it = items.find(_key_transfer_cost);
+      if (it != items.end())
+        cost.transfer_cost = to_cost(it->first, it->second);
+    }
+    else if (section.name == _section_OPCODE_COST)
+    {
+      for (auto &item : section.items)
+      {
+        if (item.first == _key_underscore)
+          cost.default_cost = to_cost(item.first, item.second);
+        else
+          cost.byopcodes.emplace(item.first, to_cost(item.first, item.second));
+      }
+    }
+    else if (section.name == _section_OPNAME_COST)
+    {
+      for (auto &item : section.items)
+        cost.byopnames.emplace(item.first, to_cost(item.first, item.second));
+    }
+  }
+
+  return by_cost;
+}
+
 } // namespace
 
 namespace partee
@@ -95,4 +156,11 @@ luci::PartitionTable read(const std::string &path)
   return partition_table;
 }
 
+bool read_cost(const std::string &path, luci::PartitionCost &cost)
+{
+  auto partition_config = crew::read_ini(path);
+
+  return parse_cost(partition_config, cost);
+}
+
 } // namespace partee
@@ -19,6 +19,7 @@
 
 #include <luci/IR/Module.h>
 #include <luci/Partition.h>
+#include <luci/PartitionCost.h>
 
 #include <string>
 #include <unordered_map>
@@ -32,6 +33,11 @@ namespace partee
  */
 luci::PartitionTable read(const std::string &path);
 
+/**
+ * @brief Reads and parse file to fill cost, and return true if 'comply' is 'cost'
+ */
+bool read_cost(const std::string &path, luci::PartitionCost &cost);
+
 } // namespace partee
 
 #endif // __CIRCLE_PARTITION_READ_H__
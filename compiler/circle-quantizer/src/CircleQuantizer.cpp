@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <foder/FileLoader.h>
+#include <foder/MappedFile.h>
 
 #include <luci/Importer.h>
 #include <luci/CircleOptimizer.h>
@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <map>
 #include <string>
 
@@ -178,19 +179,19 @@ int entry(int argc, char **argv)
   if (arser[gpd])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
-  // Load model from the file
-  foder::FileLoader file_loader{input_path};
-  std::vector<char> model_data = file_loader.load();
+  // Map model from the file, so that constants refer to it instead of copying weights
+  auto model_data = std::make_shared<foder::MappedFile>(input_path);
 
   // Verify flatbuffers
-  flatbuffers::Verifier verifier{reinterpret_cast<uint8_t *>(model_data.data()), model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_data->data()),
+                                 model_data->size()};
   if (!circle::VerifyModelBuffer(verifier))
   {
     std::cerr << "ERROR: Invalid input file '" << input_path << "'" << std::endl;
     return EXIT_FAILURE;
   }
 
-  const circle::Model *circle_model = circle::GetModel(model_data.data());
+  const circle::Model *circle_model = circle::GetModel(model_data->data());
   if (circle_model == nullptr)
   {
     std::cerr << "ERROR: Failed to load circle '" << input_path << "'" << std::endl;
@@ -199,7 +200,8 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data->data()),
+                                      model_data->size(), model_data);
 
   for (size_t idx = 0; idx < module->size(); ++idx)
   {
@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <foder/FileLoader.h>
+#include <foder/MappedFile.h>
 
 #include <luci/Importer.h>
 #include <luci/CircleOptimizer.h>
@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 
 using Algorithms = luci::CircleOptimizer::Options::Algorithm;
@@ -274,6 +275,13 @@ int entry(int argc, char **argv)
     .default_value(false)
     .help("This will turn on profiling data generation.");
 
+  arser.add_argument("--ext_buffer")
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("This will store constant data outside of the flatbuffer. May help exporting models "
+          "larger than 2GB.");
+
   arser.add_argument("input").nargs(1).type(arser::DataType::STR).help("Input circle model");
   arser.add_argument("output").nargs(1).type(arser::DataType::STR).help("Output circle model");
 
@@ -432,13 +440,12 @@ int entry(int argc, char **argv)
       options->param(AlgorithmParameters::NCHW_to_NHWC_preserve_output_shape, "true");
   }
 
-  // Load model from the file
-  foder::FileLoader file_loader{input_path};
-  std::vector<char> model_data;
+  // Map model from the file, so that constants refer to it instead of copying weights
+  std::shared_ptr<foder::MappedFile> model_data;
 
   try
   {
-    model_data = file_loader.load();
+    model_data = std::make_shared<foder::MappedFile>(input_path);
   }
   catch (const std::runtime_error &err)
   {
@@ -446,14 +453,15 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  flatbuffers::Verifier verifier{reinterpret_cast<uint8_t *>(model_data.data()), model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_data->data()),
+                                 model_data->size()};
   if (!circle::VerifyModelBuffer(verifier))
   {
     std::cerr << "ERROR: Invalid input file '" << input_path << "'" << std::endl;
     return EXIT_FAILURE;
   }
 
-  const circle::Model *circle_model = circle::GetModel(model_data.data());
+  const circle::Model *circle_model = circle::GetModel(model_data->data());
   if (circle_model == nullptr)
   {
     std::cerr << "ERROR: Failed to load circle '" << input_path << "'" << std::endl;
@@ -462,7 +470,8 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data->data()),
+                                      model_data->size(), model_data);
 
   // call luci optimizations for module
   optimizer.optimize(module.get());
@@ -490,7 +499,8 @@ int entry(int argc, char **argv)
   // Export to output Circle file
   luci::CircleExporter exporter;
 
-  luci::CircleFileExpContract contract(module.get(), output_path);
+  luci::CircleFileExpContract contract(module.get(), output_path,
+                                       arser.get<bool>("--ext_buffer"));
 
   if (!exporter.invoke(&contract))
   {
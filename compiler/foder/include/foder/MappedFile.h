@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FODER_MAPPED_FILE_H__
+#define __FODER_MAPPED_FILE_H__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace foder
+{
+
+/**
+ * @brief Read-only memory mapping of a file
+ *
+ * Unlike FileLoader, pages are read on demand and shared with the page cache, so that the data
+ * costs no copy and can be referred to while the mapping is alive.
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &path)
+  {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      std::string errmsg = "ERROR: Failed to open file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+      ::close(fd);
+      std::string errmsg = "ERROR: Failed to read file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+    _size = static_cast<size_t>(st.st_size);
+
+    // mmap fails with zero length
+    if (_size > 0)
+    {
+      void *addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED)
+      {
+        ::close(fd);
+        std::string errmsg = "ERROR: Failed to map file: " + path;
+        throw std::runtime_error(errmsg.c_str());
+      }
+      _data = static_cast<const char *>(addr);
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+  }
+
+  ~MappedFile()
+  {
+    if (_data != nullptr)
+      ::munmap(const_cast<char *>(_data), _size);
+  }
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile &operator=(MappedFile &&) = delete;
+
+public:
+  const char *data(void) const { return _data; }
+  size_t size(void) const { return _size; }
+
+private:
+  const char *_data = nullptr;
+  size_t _size = 0;
+};
+
+} // namespace foder
+
+#endif // __FODER_MAPPED_FILE_H__
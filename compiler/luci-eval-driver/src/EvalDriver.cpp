@@ -77,11 +77,11 @@ template <typename NodeT> size_t getTensorSize(const NodeT *node)
  */
 int entry(int argc, char **argv)
 {
-  if (argc != 5)
+  if (argc != 5 && argc != 6)
   {
-    std::cerr
-      << "Usage: " << argv[0]
-      << " <path/to/circle/model> <num_inputs> <path/to/input/prefix> <path/to/output/file>\n";
+    std::cerr << "Usage: " << argv[0]
+              << " <path/to/circle/model> <num_inputs> <path/to/input/prefix>"
+                 " <path/to/output/file> [num_threads]\n";
     return EXIT_FAILURE;
   }
 
@@ -89,6 +89,13 @@ int entry(int argc, char **argv)
   const int32_t num_inputs = atoi(argv[2]);
   const char *input_prefix = argv[3];
   const char *output_file = argv[4];
+  // Number of threads to run kernels with, 0 for the default of the interpreter
+  const int32_t num_threads = argc == 6 ? atoi(argv[5]) : 0;
+  if (argc == 6 && num_threads < 1)
+  {
+    std::cerr << "ERROR: The number of threads must be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
 
   // Load model from the file
   std::unique_ptr<luci::Module> module = importModel(filename);
@@ -100,6 +107,8 @@ int entry(int argc, char **argv)
 
   // Create interpreter.
   luci_interpreter::Interpreter interpreter(module.get());
+  if (num_threads > 0)
+    interpreter.setNumThreads(num_threads);
 
   // Set input.
   // Data for n'th input is read from ${input_prefix}n
@@ -55,10 +55,17 @@ public:
 
   void writeInputTensor(const luci::CircleInput *input_node, const void *data, size_t data_size);
 
+  // Returns the buffer of the input tensor, to which input data can be written directly.
+  void *getInputTensorBuffer(const luci::CircleInput *input_node);
+
   void readOutputTensor(const luci::CircleOutput *output_node, void *data, size_t data_size);
 
   void interpret();
 
+  // Sets the number of threads which an operator is run with. It is the number of hardware threads
+  // by default.
+  void setNumThreads(uint32_t num_threads);
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
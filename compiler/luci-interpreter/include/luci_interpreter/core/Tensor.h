@@ -110,6 +110,12 @@ public:
   void allocate();
   void deallocate();
 
+  // Use the given buffer, which is owned by the caller, as the storage of this tensor.
+  // The buffer is released by 'deallocate' or 'resize'.
+  void set_data_buffer(uint8_t *buffer);
+
+  size_t data_size() const { return getDataTypeSize(_element_type) * _shape.num_elements(); }
+
   const std::vector<float> &scales() const { return _quantization.scale; }
 
   const std::vector<int32_t> &zero_points() const { return _quantization.zero_point; }
@@ -119,14 +125,14 @@ public:
   template <typename T> const T *data() const
   {
     assert(_data_allocated);
-    return reinterpret_cast<const T *>(_data.get());
+    return reinterpret_cast<const T *>(_data);
   }
 
   template <typename T> T *data()
   {
     if (!_data_allocated)
       allocate();
-    return reinterpret_cast<T *>(_data.get());
+    return reinterpret_cast<T *>(_data);
   }
 
   const std::string &name() const { return _name; }
@@ -141,7 +147,9 @@ private:
   DataType _element_type;
   Shape _shape;
   AffineQuantization _quantization;
-  std::unique_ptr<uint8_t[]> _data;
+  // Storage of the tensor, which is either '_owned_data' or a buffer given by 'set_data_buffer'
+  uint8_t *_data = nullptr;
+  std::unique_ptr<uint8_t[]> _owned_data;
   std::string _name;
   bool _data_allocated;
 };
@@ -93,6 +93,17 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     tensor->writeData(data, data_size);
 }
 
+void *Interpreter::getInputTensorBuffer(const luci::CircleInput *input_node)
+{
+  Tensor *tensor = _runtime_module->getInputTensors()[input_node->index()];
+  if (tensor == nullptr)
+  {
+    const std::string &name = input_node->name();
+    throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
+  }
+  return tensor->data<void>();
+}
+
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
                                    size_t data_size)
 {
@@ -108,6 +119,11 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::setNumThreads(uint32_t num_threads)
+{
+  _runtime_module->getExecutionContext()->setNumThreads(num_threads);
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ExecutionContext.h"
+#include "kernels/Conv2D.h"
+#include "kernels/FullyConnected.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace luci_interpreter;
+
+namespace
+{
+
+// Tensor filled with random values of its type
+Tensor makeTensor(DataType type, const Shape &shape, const std::vector<float> &scales,
+                  const std::vector<int32_t> &zero_points)
+{
+  Tensor tensor(type, shape, {scales, zero_points, 0}, "");
+
+  std::mt19937 gen(0);
+  const auto num_elements = shape.num_elements();
+  switch (type)
+  {
+    case DataType::FLOAT32:
+    {
+      std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+      std::vector<float> data(num_elements);
+      for (auto &value : data)
+        value = dist(gen);
+      tensor.writeData(data.data(), data.size() * sizeof(float));
+      break;
+    }
+    case DataType::U8:
+    {
+      std::uniform_int_distribution<int32_t> dist(0, 255);
+      std::vector<uint8_t> data(num_elements);
+      for (auto &value : data)
+        value = static_cast<uint8_t>(dist(gen));
+      tensor.writeData(data.data(), data.size() * sizeof(uint8_t));
+      break;
+    }
+    case DataType::S16:
+    {
+      std::uniform_int_distribution<int32_t> dist(-32768, 32767);
+      std::vector<int16_t> data(num_elements);
+      for (auto &value : data)
+        value = static_cast<int16_t>(dist(gen));
+      tensor.writeData(data.data(), data.size() * sizeof(int16_t));
+      break;
+    }
+    case DataType::S32:
+    {
+      std::vector<int32_t> data(num_elements, 0);
+      tensor.writeData(data.data(), data.size() * sizeof(int32_t));
+      break;
+    }
+    case DataType::S64:
+    {
+      std::vector<int64_t> data(num_elements, 0);
+      tensor.writeData(data.data(), data.size() * sizeof(int64_t));
+      break;
+    }
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+  return tensor;
+}
+
+// Print average time of a kernel execution
+void measure(const std::string &name, Kernel &kernel, uint32_t iterations)
+{
+  kernel.configure();
+  // Warm up
+  kernel.execute();
+
+  const auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; ++i)
+    kernel.execute();
+  const auto end = std::chrono::steady_clock::now();
+
+  const auto elapsed = std::chrono::duration<double, std::micro>(end - begin).count();
+  std::cout << std::left << std::setw(40) << name << std::right << std::fixed
+            << std::setprecision(1) << std::setw(12) << elapsed / iterations << " us" << std::endl;
+}
+
+void benchmarkConv2D(const ExecutionContext &context, DataType type, bool per_channel,
+                     const Shape &input_shape, const Shape &filter_shape, int32_t stride,
+                     uint32_t iterations)
+{
+  const int32_t output_depth = filter_shape.dim(0);
+  const DataType bias_type = type == DataType::FLOAT32
+                               ? DataType::FLOAT32
+                               : (type == DataType::S16 ? DataType::S64 : DataType::S32);
+  const int32_t zero_point = type == DataType::U8 ? 128 : 0;
+  const std::vector<float> scales(per_channel ? output_depth : 1, 0.01f);
+  const std::vector<int32_t> zero_points(scales.size(), zero_point);
+
+  Tensor input = makeTensor(type, input_shape, {0.01f}, {zero_point});
+  Tensor filter = makeTensor(type, filter_shape, scales, zero_points);
+  Tensor bias = makeTensor(bias_type, {output_depth}, {}, {});
+  Tensor output(type, Shape{}, {{0.1f}, {zero_point}, 0}, "");
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = stride;
+  params.stride_width = stride;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::RELU;
+
+  kernels::Conv2D kernel(&input, &filter, &bias, &output, params, &context);
+
+  std::string name = std::string("Conv2D ") + (type == DataType::FLOAT32 ? "FLOAT32" : "") +
+                     (type == DataType::U8 ? (per_channel ? "U8 per-channel" : "U8") : "") +
+                     (type == DataType::S16 ? "S16" : "") + " " +
+                     std::to_string(filter_shape.dim(1)) + "x" +
+                     std::to_string(filter_shape.dim(2));
+  measure(name, kernel, iterations);
+}
+
+void benchmarkFullyConnected(const ExecutionContext &context, DataType type, int32_t batches,
+                             int32_t input_size, int32_t num_units, uint32_t iterations)
+{
+  const DataType bias_type = type == DataType::FLOAT32 ? DataType::FLOAT32 : DataType::S32;
+  const int32_t zero_point = type == DataType::U8 ? 128 : 0;
+
+  Tensor input = makeTensor(type, {batches, input_size}, {0.01f}, {zero_point});
+  Tensor weights = makeTensor(type, {num_units, input_size}, {0.01f}, {zero_point});
+  Tensor bias = makeTensor(bias_type, {num_units}, {}, {});
+  Tensor output(type, Shape{}, {{0.1f}, {zero_point}, 0}, "");
+
+  FullyConnectedParams params{};
+  params.activation = Activation::NONE;
+
+  kernels::FullyConnected kernel(&input, &weights, &bias, &output, params, &context);
+
+  std::string name = std::string("FullyConnected ") +
+                     (type == DataType::FLOAT32 ? "FLOAT32" : "U8") + " batch " +
+                     std::to_string(batches);
+  measure(name, kernel, iterations);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  uint32_t iterations = 10;
+  // 0 to run with the default number of threads of the interpreter
+  uint32_t num_threads = 0;
+  if (argc > 1)
+    iterations = std::stoul(argv[1]);
+  if (argc > 2)
+    num_threads = std::stoul(argv[2]);
+  if (argc > 3 || iterations == 0 || (argc > 2 && num_threads == 0))
+  {
+    std::cerr << "Usage: " << argv[0] << " [iterations] [num_threads]" << std::endl;
+    return 255;
+  }
+
+  ExecutionContext context;
+  if (num_threads > 0)
+    context.setNumThreads(num_threads);
+  std::cout << "Threads: " << context.getNumThreads() << std::endl;
+
+  // Typical layers of image classification models
+  const Shape conv_input{1, 56, 56, 64};
+  const Shape conv_filter_3x3{64, 3, 3, 64};
+  const Shape conv_filter_1x1{256, 1, 1, 64};
+
+  for (const auto &filter_shape : {conv_filter_3x3, conv_filter_1x1})
+  {
+    benchmarkConv2D(context, DataType::FLOAT32, false, conv_input, filter_shape, 1, iterations);
+    benchmarkConv2D(context, DataType::U8, false, conv_input, filter_shape, 1, iterations);
+    benchmarkConv2D(context, DataType::U8, true, conv_input, filter_shape, 1, iterations);
+    benchmarkConv2D(context, DataType::S16, true, conv_input, filter_shape, 1, iterations);
+  }
+
+  for (const int32_t batches : {1, 32})
+  {
+    benchmarkFullyConnected(context, DataType::FLOAT32, batches, 1024, 1000, iterations);
+    benchmarkFullyConnected(context, DataType::U8, batches, 1024, 1000, iterations);
+  }
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ExecutionContext.h"
+
+#include <public/gemmlowp.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+namespace
+{
+
+class RangeTask final : public gemmlowp::Task
+{
+public:
+  RangeTask(const std::function<void(int32_t, int32_t)> &fn, int32_t begin, int32_t end,
+            std::exception_ptr *error)
+    : _fn(fn), _begin(begin), _end(end), _error(error)
+  {
+  }
+
+  void Run() override
+  {
+    // An exception must not leave a worker thread, and is rethrown on the calling thread
+    try
+    {
+      _fn(_begin, _end);
+    }
+    catch (...)
+    {
+      *_error = std::current_exception();
+    }
+  }
+
+private:
+  const std::function<void(int32_t, int32_t)> &_fn;
+  const int32_t _begin;
+  const int32_t _end;
+  std::exception_ptr *_error;
+};
+
+} // namespace
+
+ExecutionContext::ExecutionContext() : _gemmlowp_context(std::make_unique<gemmlowp::GemmContext>())
+{
+  // hardware_concurrency() may return 0 if it is not known
+  setNumThreads(std::max(std::thread::hardware_concurrency(), 1u));
+}
+
+ExecutionContext::~ExecutionContext() = default;
+
+void ExecutionContext::setNumThreads(uint32_t num_threads)
+{
+  if (num_threads == 0)
+    throw std::runtime_error("The number of threads must be positive.");
+
+  _num_threads = num_threads;
+  _gemmlowp_context->set_max_num_threads(static_cast<int>(num_threads));
+}
+
+void ExecutionContext::parallelFor(int32_t size, int32_t min_range_size,
+                                   const std::function<void(int32_t, int32_t)> &fn) const
+{
+  if (size <= 0)
+    return;
+
+  const int32_t max_ranges = size / std::max(min_range_size, 1);
+  const int32_t num_ranges = std::min(static_cast<int32_t>(_num_threads), max_ranges);
+  if (num_ranges <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(num_ranges);
+  std::vector<gemmlowp::Task *> tasks;
+  for (int32_t i = 0; i < num_ranges; ++i)
+  {
+    const auto begin = static_cast<int32_t>(static_cast<int64_t>(size) * i / num_ranges);
+    const auto end = static_cast<int32_t>(static_cast<int64_t>(size) * (i + 1) / num_ranges);
+    tasks.push_back(new RangeTask(fn, begin, end, &errors[i]));
+  }
+  // Runs the last task on this thread, waits for the others and deletes all of them
+  _gemmlowp_context->workers_pool()->Execute(tasks);
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_EXECUTIONCONTEXT_H
+#define LUCI_INTERPRETER_CORE_EXECUTIONCONTEXT_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace gemmlowp
+{
+class GemmContext;
+} // namespace gemmlowp
+
+namespace luci_interpreter
+{
+
+// Resources which kernels share to run an operator with multiple threads.
+// Worker threads belong to the gemmlowp context, and are shared by gemmlowp GEMMs and
+// 'parallelFor'. Neither of them may be called from inside of the other.
+class ExecutionContext
+{
+public:
+  ExecutionContext();
+  ~ExecutionContext();
+
+  ExecutionContext(const ExecutionContext &) = delete;
+  ExecutionContext &operator=(const ExecutionContext &) = delete;
+
+  // Sets the number of threads including the calling one. It is the number of hardware threads by
+  // default.
+  void setNumThreads(uint32_t num_threads);
+  uint32_t getNumThreads() const { return _num_threads; }
+
+  // Splits [0, size) into ranges of at least 'min_range_size' for each thread, and calls 'fn' with
+  // the beginning and the end of each range in parallel.
+  void parallelFor(int32_t size, int32_t min_range_size,
+                   const std::function<void(int32_t, int32_t)> &fn) const;
+
+  gemmlowp::GemmContext *getGemmlowpContext() const { return _gemmlowp_context.get(); }
+
+private:
+  uint32_t _num_threads;
+  std::unique_ptr<gemmlowp::GemmContext> _gemmlowp_context;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_EXECUTIONCONTEXT_H
@@ -24,18 +24,47 @@
 namespace luci_interpreter
 {
 
+// Plans the memory of the tensors produced by kernels.
+//
+// Tensors are placed in one arena at the offsets computed from their lifetimes, so that no heap
+// allocation happens once the plan is built. The sizes are known only after the kernels are
+// configured, so the first run (and any run where a tensor outgrows its slot) allocates such
+// tensors on the heap and records their sizes, then the offsets are computed again for the next
+// runs.
 class RuntimeGraph::TensorAllocPlan
 {
-  std::vector<std::vector<Tensor *>> _alloc_plan;
-  std::vector<std::vector<Tensor *>> _dealloc_plan;
+  struct TensorInfo
+  {
+    Tensor *tensor;
+    // Indices of the kernels producing the tensor and using it lastly
+    size_t first;
+    size_t last;
+    // Size of the slot in the arena
+    size_t size;
+    size_t offset;
+  };
+
+  std::vector<TensorInfo> _tensors;
+  std::vector<std::vector<size_t>> _alloc_plan;
+  std::vector<std::vector<size_t>> _dealloc_plan;
+  std::unique_ptr<uint8_t[]> _arena;
+  // Arena replaced at the end of the last run, which may still hold the graph outputs
+  std::unique_ptr<uint8_t[]> _prev_arena;
+  size_t _arena_size = 0;
   bool _valid = false;
+  // Whether the offsets should be computed again with the sizes seen in the last run
+  bool _needs_replan = true;
 
 public:
   void invalidate() { _valid = false; }
   bool isValid() const { return _valid; }
   void build(const RuntimeGraph &graph);
-  void allocate(size_t kernel_index) const;
+  void allocate(size_t kernel_index);
   void deallocate(size_t kernel_index) const;
+  void finish();
+
+private:
+  void planOffsets();
 };
 
 void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
@@ -43,6 +72,7 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
   invalidate();
   using Lifetime = std::pair<size_t, size_t>;
   std::unordered_map<Tensor *, Lifetime> lifetimes;
+  std::vector<Tensor *> order;
   const size_t num_kernels = graph._kernels.size();
   for (size_t index = 0; index < num_kernels; ++index)
   {
@@ -57,6 +87,7 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
     {
       assert(lifetimes.count(tensor) == 0);
       lifetimes[tensor] = Lifetime(index, index);
+      order.push_back(tensor);
     }
   }
   for (const Tensor *tensor : graph.getOutputTensors())
@@ -65,32 +96,115 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
     if (lifetimes.count(nc_tensor) > 0)
       lifetimes.at(nc_tensor).second = num_kernels;
   }
-  _alloc_plan.assign(num_kernels, std::vector<Tensor *>());
-  _dealloc_plan.assign(num_kernels + 1, std::vector<Tensor *>());
-  for (const auto &item : lifetimes)
+  _tensors.clear();
+  _alloc_plan.assign(num_kernels, std::vector<size_t>());
+  _dealloc_plan.assign(num_kernels + 1, std::vector<size_t>());
+  for (Tensor *tensor : order)
   {
-    _alloc_plan[item.second.first].push_back(item.first);
-    _dealloc_plan[item.second.second].push_back(item.first);
+    const auto &lifetime = lifetimes.at(tensor);
+    _alloc_plan[lifetime.first].push_back(_tensors.size());
+    _dealloc_plan[lifetime.second].push_back(_tensors.size());
+    _tensors.push_back({tensor, lifetime.first, lifetime.second, 0, 0});
   }
+  _prev_arena = std::move(_arena);
+  _arena_size = 0;
+  _needs_replan = true;
   _valid = true;
 }
 
-void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _alloc_plan.size());
-  for (Tensor *tensor : _alloc_plan[kernel_index])
+  for (size_t id : _alloc_plan[kernel_index])
   {
-    tensor->allocate();
+    auto &info = _tensors[id];
+    const size_t size = info.tensor->data_size();
+    if (_arena != nullptr && size <= info.size)
+    {
+      info.tensor->set_data_buffer(_arena.get() + info.offset);
+    }
+    else
+    {
+      // Not planned yet or outgrows its slot
+      info.size = std::max(info.size, size);
+      info.tensor->allocate();
+      _needs_replan = true;
+    }
   }
 }
 
 void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
 {
   assert(_valid && kernel_index < _dealloc_plan.size());
-  for (Tensor *tensor : _dealloc_plan[kernel_index])
+  for (size_t id : _dealloc_plan[kernel_index])
+  {
+    _tensors[id].tensor->deallocate();
+  }
+}
+
+void RuntimeGraph::TensorAllocPlan::finish()
+{
+  // All the tensors are bound to the current arena by now
+  _prev_arena.reset();
+
+  if (_needs_replan)
+    planOffsets();
+}
+
+// Greedy by size: place larger tensors first, each at the lowest offset which does not overlap
+// the tensors already placed whose lifetimes overlap with it
+void RuntimeGraph::TensorAllocPlan::planOffsets()
+{
+  constexpr size_t alignment = 16;
+  auto align = [](size_t size) { return (size + alignment - 1) / alignment * alignment; };
+
+  std::vector<size_t> by_size(_tensors.size());
+  for (size_t i = 0; i < by_size.size(); ++i)
+    by_size[i] = i;
+  std::stable_sort(by_size.begin(), by_size.end(), [this](size_t lhs, size_t rhs) {
+    return _tensors[lhs].size > _tensors[rhs].size;
+  });
+
+  size_t arena_size = 0;
+  std::vector<size_t> placed;
+  for (size_t id : by_size)
+  {
+    auto &info = _tensors[id];
+    info.size = align(info.size);
+
+    // Collect the slots that cannot be shared, in the order of offset
+    std::vector<size_t> conflicts;
+    for (size_t other : placed)
+    {
+      const auto &other_info = _tensors[other];
+      if (other_info.first <= info.last && info.first <= other_info.last)
+        conflicts.push_back(other);
+    }
+    std::sort(conflicts.begin(), conflicts.end(), [this](size_t lhs, size_t rhs) {
+      return _tensors[lhs].offset < _tensors[rhs].offset;
+    });
+
+    size_t offset = 0;
+    for (size_t other : conflicts)
+    {
+      const auto &other_info = _tensors[other];
+      if (offset + info.size <= other_info.offset)
+        break;
+      offset = std::max(offset, other_info.offset + other_info.size);
+    }
+    info.offset = offset;
+    arena_size = std::max(arena_size, offset + info.size);
+    placed.push_back(id);
+  }
+
+  // NOTE The arena is not initialized, as every kernel writes its outputs fully
+  if (arena_size > _arena_size || _arena == nullptr)
   {
-    tensor->deallocate();
+    _prev_arena = std::move(_arena);
+    _arena.reset(new uint8_t[std::max<size_t>(arena_size, 1)]);
+    _arena_size = arena_size;
   }
+  _needs_replan = false;
 }
 
 RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module)
@@ -155,11 +269,8 @@ void RuntimeGraph::execute() const
     // TODO The `configure` method should only be called if the outputs of an operator need to be
     //  resized.
     kernel->configure();
-// TODO decide where to allocate memory, and uncomment/remove this if
-#if 0
-    _tensor_alloc_plan->allocate(
-        index); // Preallocate outputs in advance instead of relying on automatic allocation
-#endif
+    // Bind outputs to the arena in advance instead of relying on automatic allocation
+    _tensor_alloc_plan->allocate(index);
     kernel->execute();
 
     if (event_notifier != nullptr)
@@ -176,6 +287,8 @@ void RuntimeGraph::execute() const
     }
     _tensor_alloc_plan->deallocate(index);
   }
+
+  _tensor_alloc_plan->finish();
 }
 
 } // namespace luci_interpreter
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+// Fills the output with 1 + sum of the inputs, each of which should be filled with one value.
+class FillKernel : public Kernel
+{
+public:
+  FillKernel(std::vector<const Tensor *> inputs, Tensor *output, const int32_t *size)
+    : Kernel(std::move(inputs), {output}), _size(size)
+  {
+  }
+
+  void configure() override { _outputs[0]->resize({*_size}); }
+
+  void execute() const override
+  {
+    float value = 1.0f;
+    for (const Tensor *input : _inputs)
+    {
+      const float *data = input->data<float>();
+      for (int32_t i = 0; i < input->shape().num_elements(); ++i)
+        EXPECT_EQ(data[i], data[0]);
+      value += data[0];
+    }
+
+    float *data = _outputs[0]->data<float>();
+    for (int32_t i = 0; i < _outputs[0]->shape().num_elements(); ++i)
+      data[i] = value;
+  }
+
+private:
+  const int32_t *_size;
+};
+
+class RuntimeGraphTest : public ::testing::Test
+{
+protected:
+  // Graph where tensors have different sizes and overlapping lifetimes
+  //   a <= input + 1, b <= a + 1, c <= b + 1
+  //   d <= c + a + 1, output <= d + b + 1
+  void SetUp() override
+  {
+    _graph = _module.addGraph();
+    _input = addTensor();
+    Tensor *a = addTensor();
+    Tensor *b = addTensor();
+    Tensor *c = addTensor();
+    Tensor *d = addTensor();
+    _output = addTensor();
+
+    _graph->setInputTensors({_input});
+    _graph->setOutputTensors({_output});
+
+    addKernel({_input}, a, &_sizes[0]);
+    addKernel({a}, b, &_sizes[1]);
+    addKernel({b}, c, &_sizes[2]);
+    addKernel({c, a}, d, &_sizes[3]);
+    addKernel({d, b}, _output, &_sizes[4]);
+  }
+
+  Tensor *addTensor()
+  {
+    return _graph->addTensor(
+      std::make_unique<Tensor>(DataType::FLOAT32, Shape{4}, AffineQuantization{}, ""));
+  }
+
+  void addKernel(std::vector<const Tensor *> inputs, Tensor *output, const int32_t *size)
+  {
+    _graph->addKernel(std::make_unique<FillKernel>(std::move(inputs), output, size));
+  }
+
+  // Returns the output for the input filled with the value, which should be 3 * value + 8
+  std::vector<float> execute(float value)
+  {
+    std::vector<float> input(4, value);
+    _input->writeData(input.data(), input.size() * sizeof(float));
+    _graph->execute();
+
+    const float *data = _output->data<float>();
+    return std::vector<float>(data, data + _output->shape().num_elements());
+  }
+
+  RuntimeModule _module{nullptr};
+  RuntimeGraph *_graph = nullptr;
+  Tensor *_input = nullptr;
+  Tensor *_output = nullptr;
+  int32_t _sizes[5] = {64, 16, 128, 32, 8};
+};
+
+TEST_F(RuntimeGraphTest, Rerun)
+{
+  for (float value : {1.0f, 2.0f, 3.0f, 4.0f})
+  {
+    EXPECT_EQ(execute(value), std::vector<float>(8, 3 * value + 8));
+  }
+}
+
+TEST_F(RuntimeGraphTest, Rerun_Resized)
+{
+  EXPECT_EQ(execute(1.0f), std::vector<float>(8, 11.0f));
+  EXPECT_EQ(execute(2.0f), std::vector<float>(8, 14.0f));
+
+  // Tensors outgrow and shrink within their slots
+  _sizes[2] = 512;
+  _sizes[0] = 4;
+  _sizes[4] = 100;
+  EXPECT_EQ(execute(3.0f), std::vector<float>(100, 17.0f));
+  EXPECT_EQ(execute(4.0f), std::vector<float>(100, 20.0f));
+
+  _sizes[2] = 1;
+  EXPECT_EQ(execute(5.0f), std::vector<float>(100, 23.0f));
+}
+
+TEST_F(RuntimeGraphTest, Rerun_AddKernel)
+{
+  EXPECT_EQ(execute(1.0f), std::vector<float>(8, 11.0f));
+  EXPECT_EQ(execute(1.0f), std::vector<float>(8, 11.0f));
+
+  // The plan is built again for the new kernel
+  Tensor *output = addTensor();
+  addKernel({_output, _input}, output, &_sizes[0]);
+  _graph->setOutputTensors({output});
+  _output = output;
+
+  EXPECT_EQ(execute(1.0f), std::vector<float>(64, 13.0f));
+  EXPECT_EQ(execute(2.0f), std::vector<float>(64, 17.0f));
+}
+
+} // namespace
+} // namespace luci_interpreter
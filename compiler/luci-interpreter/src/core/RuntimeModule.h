@@ -19,6 +19,7 @@
 
 #include "core/RuntimeGraph.h"
 #include "core/EventNotifier.h"
+#include "core/ExecutionContext.h"
 
 #include <memory>
 #include <vector>
@@ -33,6 +34,8 @@ public:
 
   EventNotifier *getEventNotifier() const { return _event_notifier; }
 
+  ExecutionContext *getExecutionContext() { return &_execution_context; }
+
   RuntimeGraph *addGraph()
   {
     _graphs.push_back(std::make_unique<RuntimeGraph>(this));
@@ -51,6 +54,7 @@ private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
+  ExecutionContext _execution_context;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
 };
 
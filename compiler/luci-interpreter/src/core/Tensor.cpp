@@ -34,14 +34,24 @@ void Tensor::allocate()
   deallocate();
   const size_t element_size = getDataTypeSize(_element_type);
   const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _owned_data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _data = _owned_data.get();
   _data_allocated = true;
 }
 
 void Tensor::deallocate()
 {
   _data_allocated = false;
-  _data.reset();
+  _data = nullptr;
+  _owned_data.reset();
+}
+
+void Tensor::set_data_buffer(uint8_t *buffer)
+{
+  assert(buffer != nullptr);
+  deallocate();
+  _data = buffer;
+  _data_allocated = true;
 }
 
 void Tensor::readData(void *data_ptr, size_t data_size) const
@@ -30,8 +30,10 @@ namespace luci_interpreter
 namespace kernels
 {
 
-Add::Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params)
-  : KernelWithParams<AddParams>({input1, input2}, {output}, params)
+Add::Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params,
+         const ExecutionContext *execution_context)
+  : KernelWithParams<AddParams>({input1, input2}, {output}, params),
+    _execution_context(execution_context)
 {
 }
 
@@ -86,9 +88,15 @@ void Add::evalFloat() const
   }
   else
   {
-    tflite::reference_ops::Add(params, getTensorShape(input1()), getTensorData<float>(input1()),
-                               getTensorShape(input2()), getTensorData<float>(input2()),
-                               getTensorShape(output()), getTensorData<float>(output()));
+    const auto *input1_data = getTensorData<float>(input1());
+    const auto *input2_data = getTensorData<float>(input2());
+    auto *output_data = getTensorData<float>(output());
+    parallelFor(_execution_context, output()->shape().num_elements(), minRangeSize(1),
+                [&](int32_t begin, int32_t end) {
+                  const tflite::RuntimeShape shape({end - begin});
+                  tflite::reference_ops::Add(params, shape, input1_data + begin, shape,
+                                             input2_data + begin, shape, output_data + begin);
+                });
   }
 }
 
@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_KERNELS_ADD_H
 #define LUCI_INTERPRETER_KERNELS_ADD_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
@@ -28,7 +29,8 @@ namespace kernels
 class Add : public KernelWithParams<AddParams>
 {
 public:
-  Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params);
+  Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params,
+      const ExecutionContext *execution_context = nullptr);
 
   const Tensor *input1() const { return _inputs[0]; }
   const Tensor *input2() const { return _inputs[1]; }
@@ -41,6 +43,9 @@ private:
   void evalFloat() const;
   void evalQuantized() const;
   void evalQuantizedS16() const;
+
+private:
+  const ExecutionContext *_execution_context;
 };
 
 } // namespace kernels
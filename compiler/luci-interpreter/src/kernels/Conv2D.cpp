@@ -21,20 +21,189 @@
 
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 
+#include <algorithm>
+#include <numeric>
 #include <stdexcept>
-#include <thread>
 
 namespace luci_interpreter
 {
 namespace kernels
 {
 
+namespace
+{
+
+// Number of rows of the patch matrix which GEMM kernels gather at a time, so that each range of
+// rows needs a small buffer of its own instead of the whole patch matrix
+constexpr int32_t im2col_chunk_rows = 32;
+
+// Gathers the input patch of each output element into a row of 'im2col_data', so that the
+// convolution becomes a product of the patch matrix and the filter matrix.
+// Only rows in [row_begin, row_end) are gathered, from the beginning of 'im2col_data'. Out of
+// bound elements are filled with 'pad_value', which stands for zero in the input.
+template <typename T>
+void im2col(const Shape &input_shape, const T *input_data, int32_t filter_height,
+            int32_t filter_width, const Conv2DParams &params, int32_t padding_height,
+            int32_t padding_width, T pad_value, const Shape &output_shape, int32_t row_begin,
+            int32_t row_end, T *im2col_data)
+{
+  const int32_t input_height = input_shape.dim(1);
+  const int32_t input_width = input_shape.dim(2);
+  const int32_t input_depth = input_shape.dim(3);
+  const int32_t output_height = output_shape.dim(1);
+  const int32_t output_width = output_shape.dim(2);
+
+  T *row_data = im2col_data;
+  for (int32_t row = row_begin; row < row_end; ++row)
+  {
+    const int32_t batch = row / (output_height * output_width);
+    const int32_t out_y = row / output_width % output_height;
+    const int32_t out_x = row % output_width;
+    const int32_t in_y_origin = out_y * params.stride_height - padding_height;
+    const int32_t in_x_origin = out_x * params.stride_width - padding_width;
+    for (int32_t filter_y = 0; filter_y < filter_height; ++filter_y)
+    {
+      const int32_t in_y = in_y_origin + params.dilation_height_factor * filter_y;
+      for (int32_t filter_x = 0; filter_x < filter_width; ++filter_x)
+      {
+        const int32_t in_x = in_x_origin + params.dilation_width_factor * filter_x;
+        if ((in_y >= 0 && in_y < input_height) && (in_x >= 0 && in_x < input_width))
+          std::copy_n(input_data + calcOffset(input_shape, batch, in_y, in_x, 0), input_depth,
+                      row_data);
+        else
+          std::fill_n(row_data, input_depth, pad_value);
+        row_data += input_depth;
+      }
+    }
+  }
+}
+
+template <typename T> std::vector<int64_t> rowSums(const T *data, int32_t rows, int32_t depth)
+{
+  std::vector<int64_t> sums(rows);
+  for (int32_t row = 0; row < rows; ++row)
+    sums[row] = std::accumulate(data + row * depth, data + (row + 1) * depth, int64_t{0});
+  return sums;
+}
+
+// Multiplies 'lhs' of [rows, depth] by the transposed 'filter' of [channels, depth], requantizing
+// accumulators of each output channel with its own multiplier.
+// Zero points are applied to the sums of rows afterwards, so that the inner loop is a plain dot
+// product. Rows are processed in blocks, to reuse each filter row while it is in cache.
+// The dot product and the sums overflow int32 for deep filters even if the result does not, so
+// they are computed in int64 and narrowed to 'Acc' once, as the reference kernel accumulates.
+template <typename T, typename Acc>
+void convAsGemm(const T *lhs, int32_t rows, int32_t depth, int32_t lhs_zero_point,
+                const T *filter, const std::vector<int64_t> &filter_sums,
+                const std::vector<int32_t> &filter_zero_points, const Acc *bias,
+                const std::vector<ChannelQuantMultipliers> &multipliers, int32_t output_zero_point,
+                int32_t activation_min, int32_t activation_max, T *output)
+{
+  constexpr int32_t row_block = 8;
+  const auto channels = static_cast<int32_t>(filter_sums.size());
+
+  BroadcastableWrapper<ChannelQuantMultipliers> quant_multipliers(multipliers);
+  int64_t lhs_sums[row_block];
+  for (int32_t row_begin = 0; row_begin < rows; row_begin += row_block)
+  {
+    const int32_t row_end = std::min(row_begin + row_block, rows);
+    for (int32_t row = row_begin; row < row_end; ++row)
+    {
+      const T *lhs_row = lhs + row * depth;
+      lhs_sums[row - row_begin] = std::accumulate(lhs_row, lhs_row + depth, int64_t{0});
+    }
+
+    for (int32_t channel = 0; channel < channels; ++channel)
+    {
+      const T *filter_row = filter + channel * depth;
+      const int64_t filter_zero_point = filter_zero_points[channel];
+      // Sum of (lhs - lhs_zero_point) * (filter - filter_zero_point) except the cross terms
+      const int64_t offset = static_cast<int64_t>(depth) * lhs_zero_point * filter_zero_point -
+                             lhs_zero_point * filter_sums[channel] + (bias ? bias[channel] : 0);
+      const ChannelQuantMultipliers multiplier = quant_multipliers[channel];
+      for (int32_t row = row_begin; row < row_end; ++row)
+      {
+        const T *lhs_row = lhs + row * depth;
+        int64_t acc = 0;
+        for (int32_t d = 0; d < depth; ++d)
+          acc += static_cast<int64_t>(lhs_row[d]) * static_cast<int64_t>(filter_row[d]);
+        acc += offset - filter_zero_point * lhs_sums[row - row_begin];
+
+        int32_t scaled_acc = tflite::MultiplyByQuantizedMultiplier(
+          static_cast<Acc>(acc), multiplier.multiplier, multiplier.shift);
+
+        scaled_acc += output_zero_point;
+        scaled_acc = std::max(scaled_acc, activation_min);
+        scaled_acc = std::min(scaled_acc, activation_max);
+        output[row * channels + channel] = static_cast<T>(scaled_acc);
+      }
+    }
+  }
+}
+
+// Output rows of a batch, which are computed apart from the others
+struct ConvSlice
+{
+  int32_t batch;
+  int32_t out_y_begin;
+  int32_t out_y_end;
+  // Input rows which the output rows refer to, and the padding above them
+  int32_t in_y_begin;
+  int32_t in_y_end;
+  int32_t padding_height;
+};
+
+// Splits output rows of all batches into slices, and calls 'fn' on each slice in parallel
+template <typename Fn>
+void forEachConvSlice(const ExecutionContext *context, const Shape &input_shape,
+                      const Shape &filter_shape, const Shape &output_shape,
+                      const Conv2DParams &params, int32_t padding_height, const Fn &fn)
+{
+  const int32_t input_height = input_shape.dim(1);
+  const int32_t filter_height = filter_shape.dim(1);
+  const int32_t batches = output_shape.dim(0);
+  const int32_t output_height = output_shape.dim(1);
+  const int64_t ops_per_row = static_cast<int64_t>(output_shape.dim(2)) * output_shape.dim(3) *
+                              filter_shape.dim(1) * filter_shape.dim(2) * filter_shape.dim(3);
+
+  parallelFor(context, batches * output_height, minRangeSize(ops_per_row),
+              [&](int32_t begin, int32_t end) {
+                for (int32_t row = begin; row < end;)
+                {
+                  ConvSlice slice{};
+                  slice.batch = row / output_height;
+                  slice.out_y_begin = row % output_height;
+                  slice.out_y_end = std::min(output_height, slice.out_y_begin + end - row);
+
+                  const int32_t first = slice.out_y_begin * params.stride_height - padding_height;
+                  const int32_t last = (slice.out_y_end - 1) * params.stride_height -
+                                       padding_height +
+                                       (filter_height - 1) * params.dilation_height_factor + 1;
+                  // Keep an input row at least, even if the output rows refer to padding only
+                  slice.in_y_begin = std::min(std::max(first, 0), input_height - 1);
+                  slice.in_y_end = std::max(std::min(last, input_height), slice.in_y_begin + 1);
+                  slice.padding_height = slice.in_y_begin - first;
+
+                  fn(slice);
+                  row += slice.out_y_end - slice.out_y_begin;
+                }
+              });
+}
+
+} // namespace
+
 Conv2D::Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-               const Conv2DParams &params)
-  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output}, params)
+               const Conv2DParams &params, const ExecutionContext *execution_context)
+  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output}, params),
+    _execution_context(execution_context)
 {
 }
 
+Conv2D::~Conv2D()
+{
+  // Define destructor here, to delete vector of quantized multipliers properly
+}
+
 void Conv2D::configure()
 {
   // TensorFlow Lite (as of v2.2.0) supports the following combinations of types:
@@ -103,9 +272,12 @@ void Conv2D::configure()
     _params.dilation_height_factor != 1 || _params.dilation_width_factor != 1;
   const bool need_non_dilated_im2col = _params.stride_height != 1 || _params.stride_width != 1 ||
                                        filter_height != 1 || filter_width != 1;
-  const bool need_im2col =
-    input()->element_type() != DataType::S16 && (need_dilated_im2col || need_non_dilated_im2col);
-  if (need_im2col)
+  _need_im2col = need_dilated_im2col || need_non_dilated_im2col;
+  // Per-channel U8 and S16 kernels gather patches in chunks while running instead
+  const bool gemm_kernel =
+    input()->element_type() == DataType::S16 ||
+    (input()->element_type() == DataType::U8 && filter()->scales().size() > 1);
+  if (_need_im2col && !gemm_kernel)
   {
     const int input_depth = input_shape.dim(3);
     Shape im2col_shape{batches, output_height, output_width,
@@ -121,6 +293,22 @@ void Conv2D::configure()
       _im2col = nullptr;
     }
   }
+
+  if (input()->element_type() == DataType::U8 || input()->element_type() == DataType::S16)
+  {
+    const std::vector<double> effective_output_scale =
+      getQuantizedConvolutionMultiplers(input()->scale(), filter()->scales(), output()->scale());
+    _quant_multipliers = quantizeMultipliers(effective_output_scale);
+  }
+
+  // Kernels built without a context, e.g. in unit tests, run gemmlowp on a serial one of their
+  // own, instead of creating a gemmlowp context on each call.
+  if (_execution_context == nullptr && input()->element_type() == DataType::U8)
+  {
+    _serial_execution_context = std::make_unique<ExecutionContext>();
+    _serial_execution_context->setNumThreads(1);
+    _execution_context = _serial_execution_context.get();
+  }
 }
 
 void Conv2D::execute() const
@@ -173,32 +361,66 @@ void Conv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
+  const Shape &input_shape = input()->shape();
+  const Shape &output_shape = output()->shape();
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<float>(output());
+
+  // Slices of output rows are computed as convolutions of their own, which refer to the
+  // corresponding input rows with the padding adjusted.
+  const auto conv_slices = [&](bool optimized, float *im2col_data) {
+    forEachConvSlice(
+      _execution_context, input_shape, filter()->shape(), output_shape, _params, _padding_height,
+      [&](const ConvSlice &slice) {
+        tflite::ConvParams slice_params = params;
+        slice_params.padding_values.height = slice.padding_height;
+
+        const int32_t output_rows = slice.out_y_end - slice.out_y_begin;
+        const tflite::RuntimeShape slice_input_shape(
+          {1, slice.in_y_end - slice.in_y_begin, input_shape.dim(2), input_shape.dim(3)});
+        const tflite::RuntimeShape slice_output_shape(
+          {1, output_rows, output_shape.dim(2), output_shape.dim(3)});
+        const float *slice_input_data =
+          input_data + calcOffset(input_shape, slice.batch, slice.in_y_begin, 0, 0);
+        float *slice_output_data =
+          output_data + calcOffset(output_shape, slice.batch, slice.out_y_begin, 0, 0);
+
+        if (optimized)
+        {
+          const Shape &im2col_shape = _im2col->shape();
+          const tflite::RuntimeShape slice_im2col_shape(
+            {1, output_rows, im2col_shape.dim(2), im2col_shape.dim(3)});
+          float *slice_im2col_data =
+            im2col_data + calcOffset(im2col_shape, slice.batch, slice.out_y_begin, 0, 0);
+          tflite::optimized_ops::Conv(
+            slice_params, slice_input_shape, slice_input_data, getTensorShape(filter()),
+            getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+            slice_output_shape, slice_output_data, slice_im2col_shape, slice_im2col_data);
+        }
+        else
+          tflite::reference_ops::Conv(
+            slice_params, slice_input_shape, slice_input_data, getTensorShape(filter()),
+            getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+            slice_output_shape, slice_output_data, tflite::RuntimeShape(), nullptr);
+      });
+  };
+
   if (_im2col)
   {
     try
     {
-      tflite::optimized_ops::Conv(
-        params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-        getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-        getTensorShape(output()), getTensorData<float>(output()), getTensorShape(_im2col.get()),
-        getTensorData<float>(_im2col.get()));
+      conv_slices(true, getTensorData<float>(_im2col.get()));
     }
     catch (std::bad_alloc &ba)
     {
       // Failed memory allocation
       _im2col->deallocate();
 
-      tflite::reference_ops::Conv(
-        params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-        getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-        getTensorShape(output()), getTensorData<float>(output()), tflite::RuntimeShape(), nullptr);
+      conv_slices(false, nullptr);
     }
   }
   else
-    tflite::reference_ops::Conv(
-      params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-      getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-      getTensorShape(output()), getTensorData<float>(output()), tflite::RuntimeShape(), nullptr);
+    conv_slices(false, nullptr);
 }
 
 void Conv2D::evalQuantized() const
@@ -232,187 +454,110 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
-  auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
+  // Threads of gemmlowp are shared in the execution context
+  gemmlowp::GemmContext *gemmlowp_context = _execution_context->getGemmlowpContext();
 
   tflite::optimized_ops::Conv(
     params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
     getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
     getTensorShape(output()), getTensorData<uint8_t>(output()), getTensorShape(_im2col.get()),
-    getTensorData<uint8_t>(_im2col.get()), gemmlowp_context.get());
+    getTensorData<uint8_t>(_im2col.get()), gemmlowp_context);
 }
 
 void Conv2D::evalQuantizedPerChannel() const
 {
-  const auto *input_data = getTensorData<uint8_t>(input());
-  const auto *filter_data = getTensorData<uint8_t>(filter());
-  const auto *bias_data = getTensorData<int32_t>(bias());
-  auto *output_data = getTensorData<uint8_t>(output());
-
-  const Shape &input_shape = input()->shape();
   const Shape &filter_shape = filter()->shape();
   const Shape &output_shape = output()->shape();
 
-  const int32_t batches = input_shape.dim(0);
-  const int32_t input_height = input_shape.dim(1);
-  const int32_t input_width = input_shape.dim(2);
-  const int32_t input_depth = input_shape.dim(3);
   const int32_t output_depth = filter_shape.dim(0);
-  const int32_t filter_height = filter_shape.dim(1);
-  const int32_t filter_width = filter_shape.dim(2);
-  const int32_t output_height = output_shape.dim(1);
-  const int32_t output_width = output_shape.dim(2);
-
-  const int32_t stride_height = _params.stride_height;
-  const int32_t stride_width = _params.stride_width;
-  const int32_t dilation_height_factor = _params.dilation_height_factor;
-  const int32_t dilation_width_factor = _params.dilation_width_factor;
+  const int32_t depth = filter_shape.dim(1) * filter_shape.dim(2) * filter_shape.dim(3);
+  const int32_t rows = output_shape.num_elements() / output_depth;
 
   int32_t activation_min{};
   int32_t activation_max{};
   calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
 
-  const std::vector<double> effective_output_scale =
-    getQuantizedConvolutionMultiplers(input()->scale(), filter()->scales(), output()->scale());
+  const auto *input_data = getTensorData<uint8_t>(input());
+  const auto *filter_data = getTensorData<uint8_t>(filter());
+  const auto *bias_data = getTensorData<int32_t>(bias());
+  auto *output_data = getTensorData<uint8_t>(output());
+  const auto input_zero_point = static_cast<uint8_t>(input()->zero_point());
+  const auto filter_sums = rowSums(filter_data, output_depth, depth);
 
-  const std::vector<ChannelQuantMultipliers> multipliers_raw =
-    quantizeMultipliers(effective_output_scale);
-  BroadcastableWrapper<ChannelQuantMultipliers> quant_multipliers(multipliers_raw);
+  parallelFor(
+    _execution_context, rows, minRangeSize(static_cast<int64_t>(depth) * output_depth),
+    [&](int32_t begin, int32_t end) {
+      std::vector<uint8_t> im2col_data;
+      if (_need_im2col)
+        im2col_data.resize(std::min(end - begin, im2col_chunk_rows) * depth);
 
-  for (int32_t batch = 0; batch < batches; ++batch)
-  {
-    for (int32_t out_y = 0; out_y < output_height; ++out_y)
-    {
-      for (int32_t out_x = 0; out_x < output_width; ++out_x)
+      for (int32_t chunk_begin = begin; chunk_begin < end; chunk_begin += im2col_chunk_rows)
       {
-        for (int32_t out_c = 0; out_c < output_depth; ++out_c)
+        const int32_t chunk_end = std::min(chunk_begin + im2col_chunk_rows, end);
+        // Without im2col, the filter is 1x1 with unit strides and dilations, so the input is the
+        // patch matrix by itself.
+        const uint8_t *lhs_data = input_data + chunk_begin * depth;
+        if (_need_im2col)
         {
-          const int32_t in_y_origin = out_y * stride_height - _padding_height;
-          const int32_t in_x_origin = out_x * stride_width - _padding_width;
-          int32_t acc = 0;
-          for (int32_t filter_y = 0; filter_y < filter_height; ++filter_y)
-          {
-            for (int32_t filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              const int32_t in_y = in_y_origin + dilation_height_factor * filter_y;
-              const int32_t in_x = in_x_origin + dilation_width_factor * filter_x;
-              if ((in_y >= 0 && in_y < input_height) && (in_x >= 0 && in_x < input_width))
-              {
-                for (int32_t in_c = 0; in_c < input_depth; ++in_c)
-                {
-                  const uint8_t input_val =
-                    input_data[calcOffset(input_shape, batch, in_y, in_x, in_c)];
-                  const uint8_t filter_val =
-                    filter_data[calcOffset(filter_shape, out_c, filter_y, filter_x, in_c)];
-                  acc += static_cast<int32_t>(input_val - input()->zero_point()) *
-                         static_cast<int32_t>(filter_val - filter()->zero_points()[out_c]);
-                }
-              }
-            }
-          }
-          if (bias_data)
-          {
-            acc += bias_data[out_c];
-          }
-
-          int32_t scaled_acc = tflite::MultiplyByQuantizedMultiplier(
-            acc, quant_multipliers[out_c].multiplier, quant_multipliers[out_c].shift);
-
-          scaled_acc += output()->zero_point();
-          scaled_acc = std::max(scaled_acc, activation_min);
-          scaled_acc = std::min(scaled_acc, activation_max);
-          output_data[calcOffset(output_shape, batch, out_y, out_x, out_c)] = scaled_acc;
+          im2col(input()->shape(), input_data, filter_shape.dim(1), filter_shape.dim(2), _params,
+                 _padding_height, _padding_width, input_zero_point, output_shape, chunk_begin,
+                 chunk_end, im2col_data.data());
+          lhs_data = im2col_data.data();
         }
+
+        convAsGemm(lhs_data, chunk_end - chunk_begin, depth, input_zero_point, filter_data,
+                   filter_sums, filter()->zero_points(), bias_data, _quant_multipliers,
+                   output()->zero_point(), activation_min, activation_max,
+                   output_data + chunk_begin * output_depth);
       }
-    }
-  }
+    });
 }
 
 void Conv2D::evalQuantizedS16() const
 {
-  const auto *input_data = getTensorData<int16_t>(input());
-  const auto *filter_data = getTensorData<int16_t>(filter());
-  const auto *bias_data = getTensorData<int64_t>(bias());
-  auto *output_data = getTensorData<int16_t>(output());
-
-  const Shape &input_shape = input()->shape();
   const Shape &filter_shape = filter()->shape();
   const Shape &output_shape = output()->shape();
 
-  const int32_t batches = input_shape.dim(0);
-  const int32_t input_height = input_shape.dim(1);
-  const int32_t input_width = input_shape.dim(2);
-  const int32_t input_depth = input_shape.dim(3);
   const int32_t output_depth = filter_shape.dim(0);
-  const int32_t filter_height = filter_shape.dim(1);
-  const int32_t filter_width = filter_shape.dim(2);
-  const int32_t output_height = output_shape.dim(1);
-  const int32_t output_width = output_shape.dim(2);
-
-  const int32_t stride_height = _params.stride_height;
-  const int32_t stride_width = _params.stride_width;
-  const int32_t dilation_height_factor = _params.dilation_height_factor;
-  const int32_t dilation_width_factor = _params.dilation_width_factor;
+  const int32_t depth = filter_shape.dim(1) * filter_shape.dim(2) * filter_shape.dim(3);
+  const int32_t rows = output_shape.num_elements() / output_depth;
 
   int32_t activation_min{};
   int32_t activation_max{};
   calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
 
-  const std::vector<double> effective_output_scale =
-    getQuantizedConvolutionMultiplers(input()->scale(), filter()->scales(), output()->scale());
-
-  const std::vector<ChannelQuantMultipliers> multipliers_raw =
-    quantizeMultipliers(effective_output_scale);
-  BroadcastableWrapper<ChannelQuantMultipliers> multipliers(multipliers_raw);
-
-  for (int32_t batch = 0; batch < batches; ++batch)
-  {
-    for (int32_t out_y = 0; out_y < output_height; ++out_y)
-    {
-      for (int32_t out_x = 0; out_x < output_width; ++out_x)
+  const auto *input_data = getTensorData<int16_t>(input());
+  const auto *filter_data = getTensorData<int16_t>(filter());
+  const auto *bias_data = getTensorData<int64_t>(bias());
+  auto *output_data = getTensorData<int16_t>(output());
+  const auto filter_sums = rowSums(filter_data, output_depth, depth);
+  // S16 is quantized symmetrically, so zero points are all zeros.
+  const std::vector<int32_t> filter_zero_points(output_depth, 0);
+
+  parallelFor(
+    _execution_context, rows, minRangeSize(static_cast<int64_t>(depth) * output_depth),
+    [&](int32_t begin, int32_t end) {
+      std::vector<int16_t> im2col_data;
+      if (_need_im2col)
+        im2col_data.resize(std::min(end - begin, im2col_chunk_rows) * depth);
+
+      for (int32_t chunk_begin = begin; chunk_begin < end; chunk_begin += im2col_chunk_rows)
       {
-        for (int32_t out_c = 0; out_c < output_depth; ++out_c)
+        const int32_t chunk_end = std::min(chunk_begin + im2col_chunk_rows, end);
+        const int16_t *lhs_data = input_data + chunk_begin * depth;
+        if (_need_im2col)
         {
-          const int32_t in_y_origin = out_y * stride_height - _padding_height;
-          const int32_t in_x_origin = out_x * stride_width - _padding_width;
-          int64_t acc = 0;
-          for (int32_t filter_y = 0; filter_y < filter_height; ++filter_y)
-          {
-            for (int32_t filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              const int32_t in_y = in_y_origin + dilation_height_factor * filter_y;
-              const int32_t in_x = in_x_origin + dilation_width_factor * filter_x;
-              if ((in_y >= 0 && in_y < input_height) && (in_x >= 0 && in_x < input_width))
-              {
-                for (int32_t in_c = 0; in_c < input_depth; ++in_c)
-                {
-                  const int16_t input_val =
-                    input_data[calcOffset(input_shape, batch, in_y, in_x, in_c)];
-                  const int16_t filter_val =
-                    filter_data[calcOffset(filter_shape, out_c, filter_y, filter_x, in_c)];
-                  acc += static_cast<int64_t>(input_val) * static_cast<int64_t>(filter_val);
-                }
-              }
-            }
-          }
-          if (bias_data)
-          {
-            acc += bias_data[out_c];
-          }
-
-          int32_t scaled_acc = tflite::MultiplyByQuantizedMultiplier(
-            acc, multipliers[out_c].multiplier, multipliers[out_c].shift);
-
-          scaled_acc = std::max(scaled_acc, activation_min);
-          scaled_acc = std::min(scaled_acc, activation_max);
-
-          output_data[calcOffset(output_shape, batch, out_y, out_x, out_c)] = scaled_acc;
+          im2col(input()->shape(), input_data, filter_shape.dim(1), filter_shape.dim(2), _params,
+                 _padding_height, _padding_width, int16_t{0}, output_shape, chunk_begin,
+                 chunk_end, im2col_data.data());
+          lhs_data = im2col_data.data();
         }
+
+        convAsGemm(lhs_data, chunk_end - chunk_begin, depth, 0, filter_data, filter_sums,
+                   filter_zero_points, bias_data, _quant_multipliers, 0, activation_min,
+                   activation_max, output_data + chunk_begin * output_depth);
       }
-    }
-  }
+    });
 }
 
 } // namespace kernels
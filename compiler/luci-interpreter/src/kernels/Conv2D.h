@@ -17,21 +17,27 @@
 #ifndef LUCI_INTERPRETER_KERNELS_CONV2D_H
 #define LUCI_INTERPRETER_KERNELS_CONV2D_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
 #include <memory>
+#include <vector>
 
 namespace luci_interpreter
 {
 namespace kernels
 {
 
+struct ChannelQuantMultipliers;
+
 class Conv2D : public KernelWithParams<Conv2DParams>
 {
 public:
   Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-         const Conv2DParams &params);
+         const Conv2DParams &params, const ExecutionContext *execution_context = nullptr);
+
+  ~Conv2D();
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *filter() const { return _inputs[1]; }
@@ -48,9 +54,14 @@ private:
   void evalQuantizedS16() const;
 
 private:
+  const ExecutionContext *_execution_context;
+  std::unique_ptr<ExecutionContext> _serial_execution_context;
   std::unique_ptr<Tensor> _im2col;
+  bool _need_im2col{};
   int32_t _padding_height{};
   int32_t _padding_width{};
+  // Multipliers of quantized per-channel and S16 kernels, which are computed once in 'configure'
+  std::vector<ChannelQuantMultipliers> _quant_multipliers;
 };
 
 } // namespace kernels
@@ -117,6 +117,52 @@ TEST(Conv2DTest, FloatCheck)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST(Conv2DTest, Float_MultiThreaded)
+{
+  // Large enough to be split into ranges of output rows
+  Shape input_shape{2, 32, 32, 8};
+  Shape filter_shape{16, 3, 3, 8};
+  Shape bias_shape{16};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) / 13 - 0.5f;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) / 7 - 0.5f;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i) / 16;
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D ref_kernel(&input_tensor, &filter_tensor, &bias_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ExecutionContext execution_context;
+  execution_context.setNumThreads(4);
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params,
+                &execution_context);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              FloatArrayNear(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
 TEST(Conv2DTest, Uint8)
 {
   std::vector<float> input_data{
@@ -241,6 +287,132 @@ TEST(Conv2DTest, Uint8_CWQ)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST(Conv2DTest, Uint8_CWQ_Padding)
+{
+  const int output_channels = 2;
+  std::vector<float> input_data{
+    1, 2, // row = 1
+    3, 4, // row = 2
+  };
+  std::vector<float> filter_data{
+    1,  2, 3,  4, // first 2x2 filter
+    -1, 1, -1, 1, // second 2x2 filter
+  };
+  std::vector<float> bias_data{1, 2};
+  Shape filter_shape{output_channels, 2, 2, 1};
+
+  // Padded elements are the input zero point, which is not zero
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-4, 4);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<uint8_t>(-127, 128);
+
+  std::vector<std::pair<float, int32_t>> filter_quant_params;
+  filter_quant_params.push_back(quantizationParams<uint8_t>(0, 4));
+  filter_quant_params.push_back(quantizationParams<uint8_t>(-1, 1));
+
+  std::vector<float> filter_scales;
+  std::vector<int32_t> filter_zerops;
+  for (auto iter : filter_quant_params)
+  {
+    filter_scales.push_back(iter.first);
+    filter_zerops.push_back(iter.second);
+  }
+
+  std::vector<float> bias_scales;
+  for (int i = 0; i < output_channels; ++i)
+    bias_scales.push_back(filter_quant_params[i].first * input_quant_param.first);
+  std::vector<int32_t> zerop(output_channels, 0);
+
+  Tensor input_tensor = makeInputTensor<DataType::U8>({1, 2, 2, 1}, input_quant_param.first,
+                                                      input_quant_param.second, input_data);
+  Tensor filter_tensor =
+    makeInputTensor<DataType::U8>(filter_shape, filter_scales, filter_zerops, 0, filter_data);
+  Tensor bias_tensor =
+    makeInputTensor<DataType::S32>({output_channels}, bias_scales, zerop, 0, bias_data);
+  Tensor output_tensor =
+    makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+    31, 4,  // row = 1, left
+    15, -4, // row = 1, right
+    12, 3,  // row = 2, left
+    5,  -2, // row = 2, right
+  };
+  std::vector<int32_t> ref_output_shape{1, 2, 2, 2};
+  EXPECT_THAT(dequantizeTensorData(output_tensor), FloatArrayNear(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
+TEST(Conv2DTest, Uint8_CWQ_DeepFilter)
+{
+  // Raw dot products of the quantized values overflow int32, while the result does not
+  const int32_t depth = 4096;
+  const int32_t output_channels = 2;
+  Shape input_shape{1, 3, 3, depth};
+  Shape filter_shape{output_channels, 3, 3, depth};
+  const int32_t filter_size = 3 * 3 * depth;
+
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-1, 1);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<uint8_t>(-80000, 80000);
+  std::vector<float> filter_scales{quantizationParams<uint8_t>(-1, 1).first,
+                                   quantizationParams<uint8_t>(-2, 2).first};
+  std::vector<int32_t> filter_zerops{quantizationParams<uint8_t>(-1, 1).second,
+                                     quantizationParams<uint8_t>(-2, 2).second};
+
+  // Values of the largest quantized input and filter, except the smallest filter of channel 1
+  const float input_value = (255 - input_quant_param.second) * input_quant_param.first;
+  const float filter_values[] = {(255 - filter_zerops[0]) * filter_scales[0],
+                                 (0 - filter_zerops[1]) * filter_scales[1]};
+
+  std::vector<float> input_data(input_shape.num_elements(), input_value);
+  std::vector<float> filter_data;
+  for (int32_t channel = 0; channel < output_channels; ++channel)
+    filter_data.insert(filter_data.end(), filter_size, filter_values[channel]);
+  std::vector<float> bias_data{0, 0};
+  std::vector<float> bias_scales{filter_scales[0] * input_quant_param.first,
+                                 filter_scales[1] * input_quant_param.first};
+  std::vector<int32_t> zerop(output_channels, 0);
+
+  Tensor input_tensor = makeInputTensor<DataType::U8>(input_shape, input_quant_param.first,
+                                                      input_quant_param.second, input_data);
+  Tensor filter_tensor =
+    makeInputTensor<DataType::U8>(filter_shape, filter_scales, filter_zerops, 0, filter_data);
+  Tensor bias_tensor =
+    makeInputTensor<DataType::S32>({output_channels}, bias_scales, zerop, 0, bias_data);
+  Tensor output_tensor =
+    makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+
+  Conv2DParams params{};
+  params.padding = Padding::VALID;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{filter_size * input_value * filter_values[0],
+                                     filter_size * input_value * filter_values[1]};
+  std::vector<int32_t> ref_output_shape{1, 1, 1, output_channels};
+  EXPECT_THAT(dequantizeTensorData(output_tensor),
+              FloatArrayNear(ref_output_data, output_quant_param.first));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
 TEST(Conv2DTest, SInt16)
 {
   Shape input_shape{1, 4, 3, 2};
@@ -343,6 +515,120 @@ TEST(Conv2DTest, SInt16_CWQ_weights)
   EXPECT_THAT(dequantizeTensorData(output_tensor), FloatArrayNear(ref_output_data));
 }
 
+TEST(Conv2DTest, Uint8_CWQ_MultiThreaded)
+{
+  // Large enough to be split into ranges of output rows
+  const int32_t output_channels = 4;
+  Shape input_shape{2, 16, 16, 8};
+  Shape filter_shape{output_channels, 3, 3, 8};
+  Shape bias_shape{output_channels};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) / 13 - 0.5f;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) / 7 - 0.5f;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i) / 16;
+
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-0.5, 0.5);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<uint8_t>(-8, 8);
+  std::vector<float> filter_scales;
+  std::vector<int32_t> filter_zerops;
+  std::vector<float> bias_scales;
+  for (int32_t channel = 0; channel < output_channels; ++channel)
+  {
+    // Channels have different ranges, so that they have different multipliers
+    const auto quant_param = quantizationParams<uint8_t>(-0.5f - channel, 0.5f);
+    filter_scales.push_back(quant_param.first);
+    filter_zerops.push_back(quant_param.second);
+    bias_scales.push_back(quant_param.first * input_quant_param.first);
+  }
+  std::vector<int32_t> zerop(output_channels, 0);
+
+  Tensor input_tensor = makeInputTensor<DataType::U8>(input_shape, input_quant_param.first,
+                                                      input_quant_param.second, input_data);
+  Tensor filter_tensor =
+    makeInputTensor<DataType::U8>(filter_shape, filter_scales, filter_zerops, 0, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::S32>(bias_shape, bias_scales, zerop, 0, bias_data);
+  Tensor ref_output_tensor =
+    makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+  Tensor output_tensor =
+    makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D ref_kernel(&input_tensor, &filter_tensor, &bias_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ExecutionContext execution_context;
+  execution_context.setNumThreads(4);
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params,
+                &execution_context);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<uint8_t>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(Conv2DTest, SInt16_MultiThreaded)
+{
+  // Large enough to be split into ranges of output rows
+  Shape input_shape{2, 16, 16, 8};
+  Shape filter_shape{4, 3, 3, 8};
+  Shape bias_shape{4};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) - 6;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i);
+
+  Tensor input_tensor = makeInputTensor<DataType::S16>(input_shape, 0.25, 0, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::S16>(filter_shape, 0.2, 0, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::S64>(bias_shape, 0.25 * 0.2, 0, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::S16, 0.5, 0);
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 0.5, 0);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D ref_kernel(&input_tensor, &filter_tensor, &bias_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ExecutionContext execution_context;
+  execution_context.setNumThreads(4);
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params,
+                &execution_context);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<int16_t>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<int16_t>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
 TEST(Conv2DTest, Unsupported_Type_Configure_NEG)
 {
   Shape input_shape{1, 4, 3, 2};
@@ -18,6 +18,7 @@
 
 #include "kernels/Utils.h"
 
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 
 #include <stdexcept>
@@ -29,8 +30,10 @@ namespace kernels
 {
 
 FullyConnected::FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias,
-                               Tensor *output, const FullyConnectedParams &params)
-  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params)
+                               Tensor *output, const FullyConnectedParams &params,
+                               const ExecutionContext *execution_context)
+  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params),
+    _execution_context(execution_context)
 {
 }
 
@@ -68,6 +71,15 @@ void FullyConnected::configure()
     LUCI_INTERPRETER_CHECK(bias()->shape().num_elements() == weights()->shape().dim(0));
 
   output()->resize({batch_size, num_units});
+
+  // Kernels built without a context, e.g. in unit tests, run gemmlowp on a serial one of their
+  // own, instead of creating a gemmlowp context on each call.
+  if (_execution_context == nullptr && input()->element_type() == DataType::U8)
+  {
+    _serial_execution_context = std::make_unique<ExecutionContext>();
+    _serial_execution_context->setNumThreads(1);
+    _execution_context = _serial_execution_context.get();
+  }
 }
 
 void FullyConnected::execute() const
@@ -96,10 +108,49 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
-    params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
-    getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
-    getTensorShape(output()), getTensorData<float>(output()));
+  // The optimized kernel requires bias
+  if (bias())
+  {
+    const auto *input_data = getTensorData<float>(input());
+    const auto *weights_data = getTensorData<float>(weights());
+    const auto *bias_data = getTensorData<float>(bias());
+    auto *output_data = getTensorData<float>(output());
+    const int32_t batches = output()->shape().dim(0);
+    const int32_t num_units = weights()->shape().dim(0);
+    const int32_t input_size = weights()->shape().dim(1);
+
+    // Batches are split among threads, or units if there is a batch only
+    if (batches > 1)
+    {
+      parallelFor(_execution_context, batches,
+                  minRangeSize(static_cast<int64_t>(num_units) * input_size),
+                  [&](int32_t begin, int32_t end) {
+                    tflite::optimized_ops::FullyConnected(
+                      params, tflite::RuntimeShape({end - begin, input_size}),
+                      input_data + begin * input_size, getTensorShape(weights()), weights_data,
+                      getTensorShape(bias()), bias_data,
+                      tflite::RuntimeShape({end - begin, num_units}),
+                      output_data + begin * num_units);
+                  });
+    }
+    else
+    {
+      parallelFor(_execution_context, num_units, minRangeSize(input_size),
+                  [&](int32_t begin, int32_t end) {
+                    tflite::optimized_ops::FullyConnected(
+                      params, tflite::RuntimeShape({1, input_size}), input_data,
+                      tflite::RuntimeShape({end - begin, input_size}),
+                      weights_data + begin * input_size, tflite::RuntimeShape({end - begin}),
+                      bias_data + begin, tflite::RuntimeShape({1, end - begin}),
+                      output_data + begin);
+                  });
+    }
+  }
+  else
+    tflite::reference_ops::FullyConnected(
+      params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
+      getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
+      getTensorShape(output()), getTensorData<float>(output()));
 }
 
 void FullyConnected::evalQuantized() const
@@ -129,10 +180,24 @@ void FullyConnected::evalQuantized() const
   op_params.quantized_activation_max = output_activation_max;
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
-  tflite::reference_ops::FullyConnected(
-    op_params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(weights()),
-    getTensorData<uint8_t>(weights()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
-    getTensorShape(output()), getTensorData<uint8_t>(output()));
+
+  // The optimized kernel requires bias
+  if (bias())
+  {
+    // Threads of gemmlowp are shared in the execution context
+    gemmlowp::GemmContext *gemmlowp_context = _execution_context->getGemmlowpContext();
+
+    tflite::optimized_ops::FullyConnected(
+      op_params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+      getTensorShape(weights()), getTensorData<uint8_t>(weights()), getTensorShape(bias()),
+      getTensorData<int32_t>(bias()), getTensorShape(output()), getTensorData<uint8_t>(output()),
+      gemmlowp_context);
+  }
+  else
+    tflite::reference_ops::FullyConnected(
+      op_params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+      getTensorShape(weights()), getTensorData<uint8_t>(weights()), getTensorShape(bias()),
+      getTensorData<int32_t>(bias()), getTensorShape(output()), getTensorData<uint8_t>(output()));
 }
 
 } // namespace kernels
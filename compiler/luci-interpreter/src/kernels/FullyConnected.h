@@ -17,9 +17,12 @@
 #ifndef LUCI_INTERPRETER_KERNELS_FULLYCONNECTED_H
 #define LUCI_INTERPRETER_KERNELS_FULLYCONNECTED_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <memory>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -29,7 +32,8 @@ class FullyConnected : public KernelWithParams<FullyConnectedParams>
 {
 public:
   FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias, Tensor *output,
-                 const FullyConnectedParams &params);
+                 const FullyConnectedParams &params,
+                 const ExecutionContext *execution_context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *weights() const { return _inputs[1]; }
@@ -42,6 +46,10 @@ public:
 private:
   void evalFloat() const;
   void evalQuantized() const;
+
+private:
+  const ExecutionContext *_execution_context;
+  std::unique_ptr<ExecutionContext> _serial_execution_context;
 };
 
 } // namespace kernels
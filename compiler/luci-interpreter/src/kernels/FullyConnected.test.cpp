@@ -105,6 +105,57 @@ TYPED_TEST(FullyConnectedTest, Simple)
                    });
 }
 
+void CheckMultiThreaded(const Shape &input_shape, const Shape &weights_shape)
+{
+  const int32_t num_units = weights_shape.dim(0);
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> weights_data(weights_shape.num_elements());
+  std::vector<float> bias_data(num_units);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) / 13 - 0.5f;
+  for (size_t i = 0; i < weights_data.size(); ++i)
+    weights_data[i] = static_cast<float>(i % 7) / 7 - 0.5f;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i) / num_units;
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor weights_tensor = makeInputTensor<DataType::FLOAT32>(weights_shape, weights_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>({num_units}, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  FullyConnectedParams params{};
+  params.activation = Activation::NONE;
+
+  FullyConnected ref_kernel(&input_tensor, &weights_tensor, &bias_tensor, &ref_output_tensor,
+                            params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ExecutionContext execution_context;
+  execution_context.setNumThreads(4);
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params,
+                        &execution_context);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              FloatArrayNear(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(FullyConnectedTest, Float_MultiThreaded_Batches)
+{
+  // Batches are split among threads
+  CheckMultiThreaded({16, 256}, {64, 256});
+}
+
+TEST(FullyConnectedTest, Float_MultiThreaded_SingleBatch)
+{
+  // Units are split among threads
+  CheckMultiThreaded({1, 512}, {256, 512});
+}
+
 TEST(FullyConnectedTest, InvalidBiasType_NEG)
 {
   Shape input_shape{3, 2, 2, 1};
@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_KERNELS_MUL_H
 #define LUCI_INTERPRETER_KERNELS_MUL_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
@@ -31,7 +32,8 @@ namespace kernels
 class Mul : public KernelWithParams<MulParams>
 {
 public:
-  Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params);
+  Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params,
+      const ExecutionContext *execution_context = nullptr);
 
   const Tensor *input1() const { return _inputs[0]; }
   const Tensor *input2() const { return _inputs[1]; }
@@ -43,6 +45,9 @@ public:
 private:
   void evalFloat() const;
   void evalQuantizedS16() const;
+
+private:
+  const ExecutionContext *_execution_context;
 };
 
 } // namespace kernels
@@ -29,8 +29,10 @@ namespace luci_interpreter
 namespace kernels
 {
 
-Softmax::Softmax(const Tensor *input, Tensor *output, const SoftmaxParams &params)
-  : KernelWithParams<SoftmaxParams>({input}, {output}, params)
+Softmax::Softmax(const Tensor *input, Tensor *output, const SoftmaxParams &params,
+                 const ExecutionContext *execution_context)
+  : KernelWithParams<SoftmaxParams>({input}, {output}, params),
+    _execution_context(execution_context)
 {
 }
 
@@ -71,8 +73,22 @@ void Softmax::evalFloat() const
   tflite::SoftmaxParams op_params{};
   op_params.beta = params().beta;
 
-  tflite::reference_ops::Softmax(op_params, getTensorShape(input()), getTensorData<float>(input()),
-                                 getTensorShape(output()), getTensorData<float>(output()));
+  // Rows of the innermost dimension are normalized apart from each other.
+  // Rank 0 is rejected in 'configure', and an empty innermost dimension leaves no row.
+  const Shape &shape = input()->shape();
+  LUCI_INTERPRETER_CHECK(shape.num_dims() >= 1);
+  const int32_t depth = shape.dim(shape.num_dims() - 1);
+  if (depth == 0)
+    return;
+  const int32_t rows = shape.num_elements() / depth;
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<float>(output());
+  parallelFor(_execution_context, rows, minRangeSize(static_cast<int64_t>(depth) * 32),
+              [&](int32_t begin, int32_t end) {
+                const tflite::RuntimeShape rows_shape({end - begin, depth});
+                tflite::reference_ops::Softmax(op_params, rows_shape, input_data + begin * depth,
+                                               rows_shape, output_data + begin * depth);
+              });
 }
 
 template <typename T> void Softmax::evalQuantized() const
@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_KERNELS_SOFTMAX_H
 #define LUCI_INTERPRETER_KERNELS_SOFTMAX_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
@@ -28,7 +29,8 @@ namespace kernels
 class Softmax : public KernelWithParams<SoftmaxParams>
 {
 public:
-  Softmax(const Tensor *input, Tensor *output, const SoftmaxParams &params);
+  Softmax(const Tensor *input, Tensor *output, const SoftmaxParams &params,
+          const ExecutionContext *execution_context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   Tensor *output() const { return _outputs[0]; }
@@ -40,6 +42,7 @@ private:
   void evalFloat() const;
   template <typename T> void evalQuantized() const;
 
+  const ExecutionContext *_execution_context;
   float _table[256];
 };
 
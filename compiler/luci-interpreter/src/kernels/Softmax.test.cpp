@@ -97,6 +97,64 @@ TYPED_TEST(SoftmaxTest, Simple)
                    });
 }
 
+TEST(SoftmaxTest, Float_MultiThreaded)
+{
+  // Large enough to be split into ranges of rows
+  Shape input_shape{4, 64, 16};
+  std::vector<float> input_data(input_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 13) - 6;
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax ref_kernel(&input_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ExecutionContext execution_context;
+  execution_context.setNumThreads(4);
+  Softmax kernel(&input_tensor, &output_tensor, params, &execution_context);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              FloatArrayNear(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(SoftmaxTest, Float_EmptyInnermostDim)
+{
+  // There is no data to write to an empty tensor
+  Tensor input_tensor(DataType::FLOAT32, {2, 0}, {}, "");
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 0}));
+}
+
+TEST(SoftmaxTest, Float_Scalar_NEG)
+{
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>({}, {1});
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
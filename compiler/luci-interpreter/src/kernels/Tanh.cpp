@@ -25,7 +25,10 @@ namespace luci_interpreter
 namespace kernels
 {
 
-Tanh::Tanh(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+Tanh::Tanh(const Tensor *input, Tensor *output, const ExecutionContext *execution_context)
+  : Kernel({input}, {output}), _execution_context(execution_context)
+{
+}
 
 void Tanh::configure()
 {
@@ -54,8 +57,16 @@ void Tanh::execute() const
 
 void Tanh::evalFloat() const
 {
-  tflite::reference_ops::Tanh(getTensorShape(input()), getTensorData<float>(input()),
-                              getTensorShape(output()), getTensorData<float>(output()));
+  // Exponential function costs tens of operations
+  constexpr int64_t ops_per_element = 32;
+
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<float>(output());
+  parallelFor(_execution_context, output()->shape().num_elements(),
+              minRangeSize(ops_per_element), [&](int32_t begin, int32_t end) {
+                const tflite::RuntimeShape shape({end - begin});
+                tflite::reference_ops::Tanh(shape, input_data + begin, shape, output_data + begin);
+              });
 }
 
 void Tanh::evalQuantized() const
@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_KERNELS_TANH_H
 #define LUCI_INTERPRETER_KERNELS_TANH_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 
 namespace luci_interpreter
@@ -27,7 +28,7 @@ namespace kernels
 class Tanh : public Kernel
 {
 public:
-  Tanh(const Tensor *input, Tensor *output);
+  Tanh(const Tensor *input, Tensor *output, const ExecutionContext *execution_context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   Tensor *output() const { return _outputs[0]; }
@@ -43,6 +44,7 @@ private:
   uint8_t getTableValue(uint8_t idx) const { return _table[idx]; };
 
 private:
+  const ExecutionContext *_execution_context;
   uint8_t _table[256]{};
 };
 
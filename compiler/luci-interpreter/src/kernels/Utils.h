@@ -18,13 +18,16 @@
 #ifndef LUCI_INTERPRETER_KERNELS_UTILS_H
 #define LUCI_INTERPRETER_KERNELS_UTILS_H
 
+#include "core/ExecutionContext.h"
 #include "core/KernelParams.h"
 #include "luci_interpreter/core/Tensor.h"
 
 #include <tensorflow/lite/kernels/internal/types.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -157,6 +160,25 @@ private:
   int _stride;
 };
 
+// Minimum length of a range for a thread, of which each item costs 'ops_per_item' operations.
+// Below it, waking up a thread costs more than it saves.
+inline int32_t minRangeSize(int64_t ops_per_item)
+{
+  constexpr int64_t min_ops_per_range = 1 << 15;
+  const int64_t size = min_ops_per_range / std::max<int64_t>(ops_per_item, 1);
+  return static_cast<int32_t>(std::max<int64_t>(size, 1));
+}
+
+// Runs 'fn' on ranges of [0, size) in parallel, or on the whole range if there is no context
+inline void parallelFor(const ExecutionContext *context, int32_t size, int32_t min_range_size,
+                        const std::function<void(int32_t, int32_t)> &fn)
+{
+  if (context != nullptr)
+    context->parallelFor(size, min_range_size, fn);
+  else if (size > 0)
+    fn(0, size);
+}
+
 inline tflite::RuntimeShape getTensorShape(const Tensor *tensor)
 {
   if (tensor == nullptr)
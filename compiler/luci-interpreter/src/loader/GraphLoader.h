@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_LOADER_GRAPHLOADER_H
 #define LUCI_INTERPRETER_LOADER_GRAPHLOADER_H
 
+#include "core/ExecutionContext.h"
 #include "core/RuntimeGraph.h"
 #include "loader/RuntimeToIR.h"
 
@@ -32,7 +33,8 @@ class GraphLoader
 public:
   GraphLoader(const loco::Graph *graph, RuntimeGraph *runtime_graph, RuntimeToIR &runtime_to_ir,
               const std::unordered_map<const loco::Graph *, RuntimeGraph *> &graph_to_runtime_graph,
-              std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor);
+              std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor,
+              const ExecutionContext *execution_context);
 
   void loadTensors();
   void initInputOutputTensors() const;
@@ -45,6 +47,7 @@ private:
 
   const std::unordered_map<const loco::Graph *, RuntimeGraph *> &_graph_to_runtime_graph;
   std::unordered_map<const loco::Node *, Tensor *> &_node_to_tensor;
+  const ExecutionContext *_execution_context;
 };
 
 } // namespace luci_interpreter
@@ -148,7 +148,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleAdd *node)
   AddParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Add>(input1, input2, output, params);
+  return std::make_unique<kernels::Add>(input1, input2, output, params, _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleArgMax *node)
@@ -220,7 +220,8 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleConv2D *node)
   params.dilation_width_factor = node->dilation()->w();
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, params);
+  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, params,
+                                           _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDepthToSpace *node)
@@ -334,7 +335,8 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleFullyConnected *n
   FullyConnectedParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params);
+  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params,
+                                                   _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleGreater *node)
@@ -521,7 +523,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleLogistic *node)
   const Tensor *input = getInputTensor(node->x());
   Tensor *output = getOutputTensor(node);
 
-  return std::make_unique<kernels::Logistic>(input, output);
+  return std::make_unique<kernels::Logistic>(input, output, _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleLogSoftmax *node)
@@ -599,7 +601,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleMul *node)
   MulParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Mul>(input1, input2, output, params);
+  return std::make_unique<kernels::Mul>(input1, input2, output, params, _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleNeg *node)
@@ -790,7 +792,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleSoftmax *node)
   SoftmaxParams params{};
   params.beta = node->beta();
 
-  return std::make_unique<kernels::Softmax>(input, output, params);
+  return std::make_unique<kernels::Softmax>(input, output, params, _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleSpaceToDepth *node)
@@ -896,7 +898,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleTanh *node)
   const Tensor *input = getInputTensor(node->x());
   Tensor *output = getOutputTensor(node);
 
-  return std::make_unique<kernels::Tanh>(input, output);
+  return std::make_unique<kernels::Tanh>(input, output, _execution_context);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleTranspose *node)
@@ -17,6 +17,7 @@
 #ifndef LUCI_INTERPRETER_LOADER_KERNELBUILDER_H
 #define LUCI_INTERPRETER_LOADER_KERNELBUILDER_H
 
+#include "core/ExecutionContext.h"
 #include "core/Kernel.h"
 #include "core/RuntimeGraph.h"
 
@@ -34,8 +35,10 @@ class KernelBuilder : public luci::CircleNodeVisitor<std::unique_ptr<Kernel>>
 public:
   KernelBuilder(
     const std::unordered_map<const loco::Graph *, RuntimeGraph *> &graph_to_runtime_graph,
-    const std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor)
-    : _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor)
+    const std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor,
+    const ExecutionContext *execution_context)
+    : _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor),
+      _execution_context(execution_context)
   {
   }
 
@@ -117,6 +120,8 @@ private:
 private:
   const std::unordered_map<const loco::Graph *, RuntimeGraph *> &_graph_to_runtime_graph;
   const std::unordered_map<const loco::Node *, Tensor *> &_node_to_tensor;
+  // Shared by kernels which run with multiple threads
+  const ExecutionContext *_execution_context;
 };
 
 } // namespace luci_interpreter
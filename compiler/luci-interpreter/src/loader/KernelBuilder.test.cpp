@@ -115,10 +115,10 @@ protected:
     RuntimeGraph runtime_graph(nullptr);
     RuntimeToIR runtime_to_ir;
     GraphLoader graph_loader(&_graph, &runtime_graph, runtime_to_ir, graph_to_runtime_graph,
-                             _node_to_tensor);
+                             _node_to_tensor, &_execution_context);
     graph_loader.loadTensors();
 
-    KernelBuilder kernel_builder(graph_to_runtime_graph, _node_to_tensor);
+    KernelBuilder kernel_builder(graph_to_runtime_graph, _node_to_tensor, &_execution_context);
 
     auto kernel = op->accept(&kernel_builder);
     return std::unique_ptr<KernelT>(dynamic_cast<KernelT *>(kernel.release()));
@@ -132,6 +132,7 @@ protected:
 private:
   loco::Graph _graph;
   std::unordered_map<const loco::Node *, Tensor *> _node_to_tensor;
+  ExecutionContext _execution_context;
 };
 
 TEST_F(KernelBuilderTest, Add)
@@ -42,7 +42,7 @@ void ModuleLoader::load()
     const loco::Graph *graph = _module->graph(i);
     RuntimeGraph *runtime_graph = _graph_to_runtime_graph.at(graph);
     GraphLoader loader(graph, runtime_graph, _runtime_to_ir, _graph_to_runtime_graph,
-                       _node_to_tensor);
+                       _node_to_tensor, _runtime_module->getExecutionContext());
     loader.loadTensors();
     loader.initInputOutputTensors();
     loader.loadOperators();
@@ -45,10 +45,19 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Whether to store constant data outside of the flatbuffer, e.g. for models larger than 2GB
+    // Exporter then calls store_ext for the data, and the flatbuffer gets smaller
+    virtual bool ext_buffer(void) const { return false; }
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls store_ext for data outside of the flatbuffer, which is to be appended in
+    // order right after the data given to store, if ext_buffer returns true
+    // Notice: Please DO NOT STORE ptr and size when implementing this in Client
+    virtual bool store_ext(const char *, const size_t) const { return false; }
   };
 
 public:
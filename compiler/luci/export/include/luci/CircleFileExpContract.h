@@ -22,6 +22,7 @@
 #include <luci/IR/Module.h>
 #include <oops/InternalExn.h>
 
+#include <cstdio>
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -37,11 +38,17 @@ public:
   {
     // NOTHING TO DO
   }
+  CircleFileExpContract(luci::Module *module, const std::string &filename, bool ext_buffer)
+    : _module(module), _filepath(filename), _ext_buffer(ext_buffer)
+  {
+    // NOTHING TO DO
+  }
   virtual ~CircleFileExpContract() = default;
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
   luci::Module *module(void) const final { return _module; }
+  bool ext_buffer(void) const final { return _ext_buffer; }
 
 public:
   bool store(const char *ptr, const size_t size) const final
@@ -49,15 +56,36 @@ public:
     if (!ptr)
       INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
 
-    std::ofstream fs(_filepath, std::ofstream::binary);
-    fs.write(ptr, size);
+    // File is kept open for data outside of the flatbuffer, which store_ext appends
+    _fs.close();
+    _fs.clear();
+    // Data given to store_ext may be mapped from the file to overwrite, which stays valid when
+    // the file is replaced but not when it is truncated
+    if (_ext_buffer)
+      std::remove(_filepath.c_str());
+    _fs.open(_filepath, std::ofstream::binary);
+    _fs.write(ptr, size);
+    _fs.flush();
+
+    return _fs.good();
+  }
+
+  bool store_ext(const char *ptr, const size_t size) const final
+  {
+    if (!_fs.is_open())
+      INTERNAL_EXN("Data outside of the flatbuffer is stored before the flatbuffer");
+
+    _fs.write(ptr, size);
+    _fs.flush();
 
-    return fs.good();
+    return _fs.good();
   }
 
 private:
   luci::Module *_module;
   const std::string _filepath;
+  const bool _ext_buffer = false;
+  mutable std::ofstream _fs;
 };
 
 } // namespace luci
@@ -39,26 +39,30 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    CircleExporterImpl impl(module, contract->ext_buffer());
 
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
-    // we just send one time
-    return contract->store(ptr, size);
+    // we just send one time, and data outside of the flatbuffer follows if any
+    if (!contract->store(ptr, size))
+      return false;
+    return impl.storeExtBuffers(contract);
   }
 
   auto graph = contract->graph();
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
+  CircleExporterImpl impl(graph, contract->ext_buffer());
 
   const char *ptr = impl.getBufferPointer();
   const size_t size = impl.getBufferSize();
 
-  // we just send one time
-  return contract->store(ptr, size);
+  // we just send one time, and data outside of the flatbuffer follows if any
+  if (!contract->store(ptr, size))
+    return false;
+  return impl.storeExtBuffers(contract);
 }
 
 } // namespace luci
@@ -27,6 +27,7 @@
 #include <mio/circle/schema_generated.h>
 #include <flatbuffers/flatbuffers.h>
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 #include <string>
@@ -101,8 +102,16 @@ namespace luci
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, bool ext_buffer)
+  : _ext_buffer{ext_buffer}
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, bool ext_buffer) : _ext_buffer{ext_buffer}
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -127,6 +136,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._ext_buffer = _ext_buffer;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -170,6 +181,7 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+  finishExtBuffers(md);
 }
 
 void CircleExporterImpl::exportModule(Module *module)
@@ -178,6 +190,7 @@ void CircleExporterImpl::exportModule(Module *module)
   // do graph optimization
 
   SerializedModelData md;
+  md._ext_buffer = _ext_buffer;
 
   _builder.Clear();
 
@@ -237,6 +250,56 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+  finishExtBuffers(md);
+}
+
+void CircleExporterImpl::finishExtBuffers(SerializedModelData &md)
+{
+  if (md._ext_buffers.empty())
+    return;
+
+  // Data outside of the flatbuffer starts at the page following it
+  const uint64_t page_size = SerializedExtBuffer::page_size;
+  _ext_offset = (getBufferSize() + page_size - 1) / page_size * page_size;
+
+  auto model = circle::GetMutableModel(_builder.GetBufferPointer());
+  auto buffers = model->mutable_buffers();
+  for (const auto &ext : md._ext_buffers)
+  {
+    auto buffer = buffers->GetMutableObject(ext.buffer_id);
+    // NOTE This fails only if offset is not stored, which should not happen with placeholder
+    if (!buffer->mutate_offset(_ext_offset + ext.offset))
+      INTERNAL_EXN("Failed to set offset of buffer outside of flatbuffer");
+  }
+
+  _ext_buffers = std::move(md._ext_buffers);
+}
+
+bool CircleExporterImpl::storeExtBuffers(const CircleExporter::Contract *contract) const
+{
+  static const char zeros[SerializedExtBuffer::page_size] = {0};
+
+  uint64_t pos = getBufferSize();
+  for (const auto &ext : _ext_buffers)
+  {
+    // Pad up to the aligned offset
+    const uint64_t offset = _ext_offset + ext.offset;
+    assert(pos <= offset);
+    while (pos < offset)
+    {
+      const auto size = std::min<uint64_t>(offset - pos, sizeof(zeros));
+      if (!contract->store_ext(zeros, size))
+        return false;
+      pos += size;
+    }
+
+    // Data is written from CircleConst as it is
+    if (!contract->store_ext(reinterpret_cast<const char *>(ext.data), ext.size))
+      return false;
+    pos += ext.size;
+  }
+
+  return true;
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
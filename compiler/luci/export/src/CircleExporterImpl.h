@@ -38,8 +38,11 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  /**
+   * @param ext_buffer store constant data outside of the flatbuffer if true
+   */
+  explicit CircleExporterImpl(loco::Graph *graph, bool ext_buffer = false);
+  explicit CircleExporterImpl(Module *module, bool ext_buffer = false);
 
   /**
    * @return pointer to buffer with serialized graph
@@ -51,6 +54,12 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @brief store constant data outside of the flatbuffer, which follows the serialized graph
+   * @return false if contract fails to store
+   */
+  bool storeExtBuffers(const CircleExporter::Contract *contract) const;
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -71,8 +80,19 @@ private:
    */
   void exportModule(Module *module);
 
+  /**
+   * @brief set offsets of constant data outside of the finished flatbuffer
+   * @param md information about serialized parts of model
+   */
+  void finishExtBuffers(SerializedModelData &md);
+
 private:
   flatbuffers::FlatBufferBuilder _builder;
+
+  bool _ext_buffer = false;
+  std::vector<SerializedExtBuffer> _ext_buffers;
+  // Offset in file where data outside of the flatbuffer begins
+  uint64_t _ext_offset = 0;
 };
 
 } // namespace luci
@@ -334,43 +334,41 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, N
   return CreateBuffer(builder);
 }
 
-template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+struct ConstBytes
+{
+  const uint8_t *data;
+  size_t size;
+};
+
+template <loco::DataType DT> ConstBytes const_bytes_by_dtype(const luci::CircleConst *c)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
-  return CreateBuffer(builder, array_offset);
+  if (size == 0)
+    return ConstBytes{nullptr, 0};
+  // Elements are contiguous, and read without copy
+  return ConstBytes{reinterpret_cast<const uint8_t *>(&c->at<DT>(0)), size * sizeof(NativeType)};
 }
 
-template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+ConstBytes const_bytes(const luci::CircleConst *c)
 {
   switch (c->dtype())
   {
     case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::FLOAT32>(c);
     case loco::DataType::S8:
-      return encodeOpBufferByDType<loco::DataType::S8>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::S8>(c);
     case loco::DataType::S16:
-      return encodeOpBufferByDType<loco::DataType::S16>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::S16>(c);
     case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::S32>(c);
     case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::S64>(c);
     case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::U8>(c);
     case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
+      return const_bytes_by_dtype<loco::DataType::BOOL>(c);
     default:
       break;
   }
@@ -378,6 +376,36 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, l
   INTERNAL_EXN_V("Unsupported datatype", oops::to_uint32(c->dtype()));
 }
 
+template <>
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+{
+  const auto bytes = const_bytes(c);
+  auto array_offset = builder.CreateVector(bytes.data, bytes.size);
+  return CreateBuffer(builder, array_offset);
+}
+
+flatbuffers::Offset<circle::Buffer> encodeExtBuffer(FlatBufferBuilder &builder,
+                                                    SerializedModelData &md, luci::CircleConst *c,
+                                                    uint32_t buffer_id)
+{
+  const auto bytes = const_bytes(c);
+  if (bytes.size == 0)
+    return encodeOpBuffer(builder, c);
+
+  uint64_t offset = 0;
+  if (!md._ext_buffers.empty())
+    offset = md._ext_buffers.back().offset + md._ext_buffers.back().size;
+  const uint64_t align = bytes.size >= SerializedExtBuffer::page_size
+                           ? SerializedExtBuffer::page_size
+                           : SerializedExtBuffer::align;
+  offset = (offset + align - 1) / align * align;
+  md._ext_buffers.push_back(SerializedExtBuffer{buffer_id, bytes.data, offset, bytes.size});
+
+  // NOTE offset is a placeholder to be patched when the flatbuffer is finished, and not the
+  //      default value so that it is stored
+  return CreateBuffer(builder, 0, 1 /* offset */, bytes.size);
+}
+
 flatbuffers::Offset<circle::QuantizationParameters>
 encodeQuantizationParameters(FlatBufferBuilder &builder, luci::CircleQuantParam *quantparam)
 {
@@ -432,7 +460,8 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -498,9 +527,9 @@ uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci
     }
 
     // When buffer with same values is not found, generate new buffer
-    auto buffer = encodeOpBuffer(builder, node);
-
     auto buffer_id = static_cast<uint32_t>(md._buffers.size());
+    auto buffer = md._ext_buffer ? encodeExtBuffer(builder, md, node, buffer_id)
+                                 : encodeOpBuffer(builder, node);
     md._buffers.push_back(buffer);
 
     // Cache the newly generated buffer id
@@ -109,6 +109,24 @@ struct SubGraphContext
   circle::DataFormat _data_format{circle::DataFormat::DataFormat_CHANNELS_LAST};
 };
 
+/**
+ * @brief Constant data stored outside of the flatbuffer, after it in the file
+ *
+ * Data of a page or larger starts at a page boundary so that it can be mapped alone, and others
+ * are aligned like data of circle::Buffer in the flatbuffer.
+ */
+struct SerializedExtBuffer
+{
+  static constexpr uint64_t page_size = 4096;
+  static constexpr uint64_t align = 16;
+
+  uint32_t buffer_id;
+  const uint8_t *data;
+  // Offset from the beginning of data outside of the flatbuffer
+  uint64_t offset;
+  uint64_t size;
+};
+
 // Prerequisites for circle::Model object creation
 struct SerializedModelData final
 {
@@ -122,6 +140,10 @@ struct SerializedModelData final
   // This is used for removing buffers with same values
   std::map<luci::CircleConst *, uint32_t> _cached_buffer_id;
 
+  // Store constant data outside of the flatbuffer if true
+  bool _ext_buffer = false;
+  std::vector<SerializedExtBuffer> _ext_buffers;
+
   /**
    * @brief if opcode is not registered in table of opcodes add it
    * @param builtin_code
@@ -59,12 +59,12 @@ void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node);
 class CircleReader
 {
 private:
-  using CircleBuffers_t = std::vector<std::unique_ptr<circle::BufferT>>;
   using CircleTensors_t = std::vector<std::unique_ptr<circle::TensorT>>;
   using CircleOperators_t = std::vector<std::unique_ptr<circle::OperatorT>>;
   using CircleOperatorCodes_t = std::vector<std::unique_ptr<circle::OperatorCodeT>>;
   using CircleMetadata_t = std::vector<std::unique_ptr<circle::MetadataT>>;
 
+  using CircleBuffersPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::Buffer>>;
   using CircleSubGraphsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::SubGraph>>;
   using CircleTensorsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::Tensor>>;
 
@@ -73,7 +73,8 @@ public:
 
 public:
   const CircleOperatorCodes_t &opcodes() const { return _model->operator_codes; }
-  const CircleBuffers_t &buffers() const { return _model->buffers; }
+  // NOTE buffers are read in place without unpacking, and may be null if there is none
+  const CircleBuffersPtr_t *buffers() const { return _model_ptr->buffers(); }
   const CircleTensors_t &tensors() const { return _current_subgraph->tensors; }
   const CircleOperators_t &operators() const { return _current_subgraph->operators; }
   const std::vector<int32_t> &inputs() const { return _current_subgraph->inputs; }
@@ -83,6 +84,10 @@ public:
   const CircleMetadata_t &metadata() const { return _model->metadata; }
 
   const CircleTensorsPtr_t *tensors_ptr() const { return _tensors_ptr; }
+  // Owner of the model data if constants may refer to it, or null to copy
+  const std::shared_ptr<const void> &model_owner() const { return _model_owner; }
+  // Data outside of the flatbuffer, or null if it is not in the model data
+  const uint8_t *ext_data(uint64_t offset, uint64_t size) const;
 
   uint32_t num_subgraph() const { return _model->subgraphs.size(); }
 
@@ -91,6 +96,12 @@ public:
 
 public:
   bool parse(const circle::Model *model);
+  /**
+   * @brief Parse model in data of size bytes, which owner keeps alive
+   * @note  Constants refer to buffers of the model instead of copying them, and buffers outside
+   *        of the flatbuffer are read from data
+   */
+  bool parse(const uint8_t *data, size_t size, std::shared_ptr<const void> owner);
   bool select_subgraph(uint32_t subgraph);
 
 private:
@@ -99,6 +110,9 @@ private:
 
   const circle::Model *_model_ptr{nullptr};
   const CircleTensorsPtr_t *_tensors_ptr{nullptr};
+  const uint8_t *_model_data{nullptr};
+  size_t _model_size{0};
+  std::shared_ptr<const void> _model_owner;
 };
 
 } // namespace luci
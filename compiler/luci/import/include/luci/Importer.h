@@ -44,6 +44,16 @@ public:
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  /**
+   * @brief Import model in data of size bytes, which owner keeps alive, e.g. a mapped file
+   * @note  Constants refer to the data instead of copying it until they are mutated, and
+   *        buffers stored outside of the flatbuffer are read from it
+   */
+  std::unique_ptr<Module> importModule(const uint8_t *data, size_t size,
+                                       std::shared_ptr<const void> owner) const;
+
+private:
+  std::unique_ptr<Module> convertModule(CircleReader &reader) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
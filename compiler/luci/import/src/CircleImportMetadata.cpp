@@ -146,8 +146,10 @@ CircleImportMetadata::CircleImportMetadata(const luci::CircleReader &reader)
   {
     const circle::MetadataT &meta = *metadata[i];
 
-    assert(meta.buffer < reader.buffers().size());
-    const std::vector<uint8_t> &buffer = reader.buffers()[meta.buffer]->data;
+    assert(reader.buffers() != nullptr && meta.buffer < reader.buffers()->size());
+    const auto data = reader.buffers()->Get(meta.buffer)->data();
+    const std::vector<uint8_t> buffer =
+      data != nullptr ? std::vector<uint8_t>(data->begin(), data->end()) : std::vector<uint8_t>{};
 
     if (meta.name.compare("ONE_op_table") == 0)
       _op_table = decoded_op_table(buffer);
@@ -323,7 +323,32 @@ bool CircleReader::parse(const circle::Model *model)
 {
   assert(model != nullptr);
 
-  _model.reset(model->UnPack());
+  // Unpack all but buffers, which are read in place as copying them costs as much as weights
+  auto model_t = std::make_unique<circle::ModelT>();
+  model_t->version = model->version();
+  if (model->operator_codes() != nullptr)
+  {
+    for (const auto opcode : *model->operator_codes())
+      model_t->operator_codes.emplace_back(opcode->UnPack());
+  }
+  if (model->subgraphs() != nullptr)
+  {
+    for (const auto subgraph : *model->subgraphs())
+      model_t->subgraphs.emplace_back(subgraph->UnPack());
+  }
+  if (model->description() != nullptr)
+    model_t->description = model->description()->str();
+  if (model->metadata_buffer() != nullptr)
+  {
+    model_t->metadata_buffer.assign(model->metadata_buffer()->begin(),
+                                    model->metadata_buffer()->end());
+  }
+  if (model->metadata() != nullptr)
+  {
+    for (const auto metadata : *model->metadata())
+      model_t->metadata.emplace_back(metadata->UnPack());
+  }
+  _model = std::move(model_t);
 
   // for direct pointer access
   _model_ptr = model;
@@ -331,6 +356,28 @@ bool CircleReader::parse(const circle::Model *model)
   return true;
 }
 
+bool CircleReader::parse(const uint8_t *data, size_t size, std::shared_ptr<const void> owner)
+{
+  assert(data != nullptr);
+
+  if (!parse(circle::GetModel(data)))
+    return false;
+
+  _model_data = data;
+  _model_size = size;
+  _model_owner = std::move(owner);
+
+  return true;
+}
+
+const uint8_t *CircleReader::ext_data(uint64_t offset, uint64_t size) const
+{
+  if (_model_data == nullptr || offset > _model_size || size > _model_size - offset)
+    return nullptr;
+
+  return _model_data + offset;
+}
+
 bool CircleReader::select_subgraph(uint32_t sgindex)
 {
   if (_model->subgraphs.size() <= sgindex)
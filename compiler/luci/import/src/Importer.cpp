@@ -275,6 +275,25 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  CircleReader reader;
+  if (!reader.parse(model))
+    return nullptr;
+
+  return convertModule(reader);
+}
+
+std::unique_ptr<Module> Importer::importModule(const uint8_t *data, size_t size,
+                                               std::shared_ptr<const void> owner) const
+{
+  CircleReader reader;
+  if (!reader.parse(data, size, std::move(owner)))
+    return nullptr;
+
+  return convertModule(reader);
+}
+
+std::unique_ptr<Module> Importer::convertModule(CircleReader &reader) const
 {
   auto module = make_module();
 
@@ -286,10 +305,6 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
     source_ptr = _source;
   }
 
-  CircleReader reader;
-  if (!reader.parse(model))
-    return nullptr;
-
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
   {
     auto graph = loco::make_graph();
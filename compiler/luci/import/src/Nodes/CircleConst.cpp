@@ -23,6 +23,7 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
 
 namespace
 {
@@ -46,19 +47,26 @@ namespace luci
 {
 
 template <loco::DataType DT>
-static void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements,
-                      CircleConst *const_node)
+static void copy_data(const uint8_t *raw_data, size_t raw_size, uint32_t num_elements,
+                      CircleConst *const_node, const std::shared_ptr<const void> &owner)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
   // TODO calculate the exact buffer size of sparse tensor
   if (const_node->sparsityparam())
   {
-    num_elements = raw_data.size() / sizeof(T);
+    num_elements = raw_size / sizeof(T);
   }
 
-  assert(raw_data.size() == num_elements * sizeof(T));
-  const auto *data = reinterpret_cast<const T *>(raw_data.data());
+  assert(raw_size == num_elements * sizeof(T));
+  const auto *data = reinterpret_cast<const T *>(raw_data);
+
+  // Refer to the model data if it outlives the node, which copies it only when mutated
+  if (owner != nullptr && reinterpret_cast<uintptr_t>(data) % alignof(T) == 0)
+  {
+    const_node->borrow<DT>(owner, data, num_elements);
+    return;
+  }
 
   const_node->size<DT>(num_elements);
   for (uint32_t i = 0; i < num_elements; ++i)
@@ -76,9 +84,26 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
   const auto &tensors = reader->tensors();
   const circle::TensorT &const_tensor = *tensors[tensor_index];
 
-  const std::vector<uint8_t> &buffer = reader->buffers()[const_tensor.buffer]->data;
+  assert(reader->buffers() != nullptr && const_tensor.buffer < reader->buffers()->size());
+  // Buffers are read in place, and have no data vector if empty
+  const auto buffer = reader->buffers()->Get(const_tensor.buffer);
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  if (buffer->data() != nullptr)
+  {
+    data = buffer->data()->data();
+    size = buffer->data()->size();
+  }
+  else if (buffer->offset() > 1)
+  {
+    // Data is stored outside of the flatbuffer
+    data = reader->ext_data(buffer->offset(), buffer->size());
+    if (data == nullptr)
+      throw oops::UserExn("Buffer is outside of model data", const_tensor.name);
+    size = buffer->size();
+  }
   std::vector<int32_t> const_dims = const_tensor.shape; // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && size == 0)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -98,7 +123,7 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (size == 0 && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -111,34 +136,35 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
           << const_dims << std::endl;
   if (num_elements > 0)
   {
+    const auto &owner = reader->model_owner();
     switch (luci_datatype(const_tensor.type))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::FLOAT32>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::U8>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S8>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S16>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S32>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S64>(data, size, num_elements, const_node, owner);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::BOOL>(data, size, num_elements, const_node, owner);
         break;
 
       default:
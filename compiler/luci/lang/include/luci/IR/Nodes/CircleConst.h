@@ -24,6 +24,8 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
@@ -45,8 +47,27 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+  /**
+   * @brief Refer to size elements at data, which owner keeps alive, instead of copying them
+   * @note  Elements are copied on the first non-const access, which may mutate them
+   */
+  template <loco::DataType DT>
+  void borrow(std::shared_ptr<const void> owner, const typename loco::DataTypeImpl<DT>::Type *data,
+              uint32_t size);
+  bool borrowed(void) const { return _borrowed != nullptr; }
+
+private:
+  const uint8_t *buffer(void) const { return borrowed() ? _borrowed : _data.data(); }
+  size_t buffer_size(void) const { return borrowed() ? _borrowed_size : _data.size(); }
+  // Copy borrowed elements to own them
+  void own(void);
+
 private:
   std::vector<uint8_t> _data;
+  // Borrowed elements, which are used instead of _data if not null
+  std::shared_ptr<const void> _owner;
+  const uint8_t *_borrowed = nullptr;
+  size_t _borrowed_size = 0;
 };
 
 } // namespace luci
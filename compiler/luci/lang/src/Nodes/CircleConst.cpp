@@ -17,6 +17,7 @@
 #include "luci/IR/Nodes/CircleConst.h"
 
 #include <cassert>
+#include <cstdint>
 
 namespace luci
 {
@@ -24,13 +25,14 @@ namespace luci
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(buffer_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return buffer_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  own();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +41,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(buffer()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,22 +56,51 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(buffer()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
+template <loco::DataType DT>
+void CircleConst::borrow(std::shared_ptr<const void> owner,
+                         const typename loco::DataTypeImpl<DT>::Type *data, uint32_t size)
+{
+  assert(dtype() == DT);
+  assert(owner != nullptr);
+  assert(data != nullptr);
+  assert(reinterpret_cast<uintptr_t>(data) % alignof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  _data.clear();
+  _data.shrink_to_fit();
+  _owner = std::move(owner);
+  _borrowed = reinterpret_cast<const uint8_t *>(data);
+  _borrowed_size = size * sizeof(typename loco::DataTypeImpl<DT>::Type);
+}
+
+void CircleConst::own(void)
+{
+  if (!borrowed())
+    return;
+
+  _data.assign(_borrowed, _borrowed + _borrowed_size);
+  _owner.reset();
+  _borrowed = nullptr;
+  _borrowed_size = 0;
+}
+
 #define INSTANTIATE(DT)                                                                      \
   template uint32_t CircleConst::size<DT>(void) const;                                       \
   template void CircleConst::size<DT>(uint32_t);                                             \
   template const typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t) const; \
   template typename loco::DataTypeImpl<DT>::Type &CircleConst::at<DT>(uint32_t);             \
   template const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void) const; \
-  template typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void);
+  template typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar<DT>(void);             \
+  template void CircleConst::borrow<DT>(std::shared_ptr<const void>,                         \
+                                        const typename loco::DataTypeImpl<DT>::Type *, uint32_t);
 
 INSTANTIATE(loco::DataType::S64);
 INSTANTIATE(loco::DataType::S32);
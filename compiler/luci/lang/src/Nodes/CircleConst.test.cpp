@@ -51,3 +51,42 @@ TEST(CircleConstTest, scalar)
   auto const &cs = const_node.scalar<loco::DataType::S32>();
   ASSERT_EQ(1, cs);
 }
+
+TEST(CircleConstTest, borrow)
+{
+  auto data = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f, 3.0f});
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::FLOAT32);
+  const_node.borrow<loco::DataType::FLOAT32>(data, data->data(), 3);
+  ASSERT_TRUE(const_node.borrowed());
+  ASSERT_EQ(2, data.use_count());
+
+  const auto &cconst_node = const_node;
+  ASSERT_EQ(3, cconst_node.size<loco::DataType::FLOAT32>());
+  ASSERT_EQ(data->data() + 1, &cconst_node.at<loco::DataType::FLOAT32>(1));
+  ASSERT_TRUE(const_node.borrowed());
+
+  // Mutation copies elements, and leaves the borrowed ones as they are
+  const_node.at<loco::DataType::FLOAT32>(1) = 4.0f;
+  ASSERT_FALSE(const_node.borrowed());
+  ASSERT_EQ(1, data.use_count());
+  ASSERT_EQ(2.0f, data->at(1));
+  ASSERT_EQ(1.0f, cconst_node.at<loco::DataType::FLOAT32>(0));
+  ASSERT_EQ(4.0f, cconst_node.at<loco::DataType::FLOAT32>(1));
+  ASSERT_EQ(3.0f, cconst_node.at<loco::DataType::FLOAT32>(2));
+}
+
+TEST(CircleConstTest, borrow_resize)
+{
+  auto data = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2});
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::S32);
+  const_node.borrow<loco::DataType::S32>(data, data->data(), 2);
+  const_node.size<loco::DataType::S32>(3);
+
+  ASSERT_FALSE(const_node.borrowed());
+  ASSERT_EQ(3, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(2, const_node.at<loco::DataType::S32>(1));
+}
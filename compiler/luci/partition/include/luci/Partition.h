@@ -38,7 +38,8 @@ struct PartitionTable
   // assign by opcode name: OPCODENAME=group
   std::unordered_map<std::string /* OPCODENAME */, std::string /* group */> byopcodes;
 
-  // TODO add assign by OP name
+  // assign by OP name: OPNAME=group, which precedes byopcodes
+  std::unordered_map<std::string /* OPNAME */, std::string /* group */> byopnames;
 };
 
 /**
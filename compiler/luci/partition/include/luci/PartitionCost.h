@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARTITION_COST_H__
+#define __LUCI_PARTITION_COST_H__
+
+#include "luci/Partition.h"
+
+#include <luci/IR/Module.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace luci
+{
+
+/**
+ * @brief PartitionCost holds cost estimates to partition by
+ * @note  Costs are in any unit, e.g. microseconds, as long as all of them are in the same one
+ */
+struct PartitionCost
+{
+  // cost of an operator by opcode name: OPCODENAME=cost
+  std::unordered_map<std::string /* OPCODENAME */, double> byopcodes;
+
+  // cost of an operator by OP name, e.g. measured one, which precedes byopcodes
+  std::unordered_map<std::string /* OPNAME */, double> byopnames;
+
+  // cost of an operator which is in neither of above
+  double default_cost = 1.0;
+
+  // cost to transfer a byte of tensor from one partition to another
+  double transfer_cost = 0.0;
+};
+
+/**
+ * @brief Assign operators to groups of PartitionTable by cost, as pipeline stages
+ * @note  Operators are split in topological order into as many stages as groups, so that the
+ *        most costly stage is the cheapest possible, then tensor bytes across stages are the
+ *        fewest. Cost of a stage is the cost of its operators plus the cost to transfer tensors
+ *        from the previous stages. Stages are assigned to groups in order, by byopnames.
+ */
+void assign_by_cost(const Module *source, const PartitionCost &cost, PartitionTable &partition);
+
+} // namespace luci
+
+#endif // __LUCI_PARTITION_COST_H__
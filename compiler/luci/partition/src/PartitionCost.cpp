@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CircleOpCode.h"
+
+#include "luci/PartitionCost.h"
+#include "luci/Log.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+#include <loco/IR/DataTypeTraits.h>
+#include <oops/UserExn.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief return true if node is allocated to a partition
+ * @note  This should be same as check_allocate_partition() in PartitionPGroups.cpp
+ */
+bool is_partition_op(const luci::CircleNode *node)
+{
+  if (dynamic_cast<const luci::CircleInput *>(node) != nullptr)
+    return false;
+  if (dynamic_cast<const luci::CircleOutput *>(node) != nullptr)
+    return false;
+  if (dynamic_cast<const luci::CircleConst *>(node) != nullptr)
+    return false;
+  return true;
+}
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    // NOTE unknown dimension is regarded as 1
+    if (node->dim(i).known())
+      bytes *= node->dim(i).value();
+  }
+  return bytes;
+}
+
+double op_cost(const luci::CircleNode *node, const luci::PartitionCost &cost)
+{
+  auto nit = cost.byopnames.find(node->name());
+  if (nit != cost.byopnames.end())
+    return nit->second;
+
+  auto it = cost.byopcodes.find(luci::opcode_name(node));
+  if (it != cost.byopcodes.end())
+    return it->second;
+
+  return cost.default_cost;
+}
+
+/**
+ * @brief Stages of first operators, of which the last one begins at 'begin'
+ */
+struct Plan
+{
+  // cost of the most costly stage
+  double max_cost = std::numeric_limits<double>::infinity();
+  // bytes of tensors across stages
+  uint64_t bytes = std::numeric_limits<uint64_t>::max();
+  uint32_t begin = 0;
+};
+
+bool is_better(const Plan &lhs, const Plan &rhs)
+{
+  if (lhs.max_cost != rhs.max_cost)
+    return lhs.max_cost < rhs.max_cost;
+  return lhs.bytes < rhs.bytes;
+}
+
+} // namespace
+
+namespace luci
+{
+
+void assign_by_cost(const Module *source, const PartitionCost &cost, PartitionTable &partition)
+{
+  assert(source != nullptr);
+  if (source->size() != 1)
+    throw oops::UserExn("Only a single subgraph can be assigned by cost");
+
+  LOGGER(l);
+
+  if (partition.groups.empty())
+    throw oops::UserExn("There is no group to assign by cost");
+
+  // Operators in topological order, which any split of keeps stages acyclic
+  auto graph = source->graph();
+  std::vector<const luci::CircleNode *> ops;
+  std::map<const loco::Node *, uint32_t> position;
+  std::set<std::string> names;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (!is_partition_op(circle_node))
+      continue;
+    // operators are assigned by OP name
+    if (!names.insert(circle_node->name()).second)
+      throw oops::UserExn("OP name is not unique to assign by cost", circle_node->name());
+
+    position[node] = static_cast<uint32_t>(ops.size());
+    ops.push_back(circle_node);
+  }
+  const auto num_ops = static_cast<uint32_t>(ops.size());
+  if (num_ops == 0)
+    return;
+
+  // costs[e] is the cost of first e operators
+  std::vector<double> costs(num_ops + 1, 0.0);
+  // cuts[b] is bytes of tensors across the boundary before ops[b]
+  std::vector<uint64_t> cuts(num_ops + 1, 0);
+  {
+    std::vector<int64_t> diffs(num_ops + 2, 0);
+    for (uint32_t p = 0; p < num_ops; ++p)
+    {
+      costs[p + 1] = costs[p] + op_cost(ops[p], cost);
+
+      uint32_t last = p;
+      for (auto succ : loco::succs(ops[p]))
+      {
+        auto it = position.find(succ);
+        if (it != position.end())
+          last = std::max(last, it->second);
+      }
+      // the tensor of ops[p] is across boundaries before ops[p + 1] to ops[last]
+      const auto bytes = static_cast<int64_t>(tensor_bytes(ops[p]));
+      diffs[p + 1] += bytes;
+      diffs[last + 1] -= bytes;
+    }
+    int64_t bytes = 0;
+    for (uint32_t b = 0; b <= num_ops; ++b)
+    {
+      bytes += diffs[b];
+      cuts[b] = static_cast<uint64_t>(bytes);
+    }
+  }
+
+  // stage of ops[begin] to ops[end - 1] receives tensors across the boundary before it
+  auto stage_cost = [&](uint32_t begin, uint32_t end) {
+    return costs[end] - costs[begin] + cost.transfer_cost * static_cast<double>(cuts[begin]);
+  };
+
+  // plans[s][e] is the best plan of first e operators in s + 1 stages
+  const auto num_stages = std::min(static_cast<uint32_t>(partition.groups.size()), num_ops);
+  std::vector<std::vector<Plan>> plans(num_stages, std::vector<Plan>(num_ops + 1));
+  for (uint32_t e = 1; e <= num_ops; ++e)
+  {
+    plans[0][e].max_cost = stage_cost(0, e);
+    plans[0][e].bytes = 0;
+  }
+  for (uint32_t s = 1; s < num_stages; ++s)
+  {
+    for (uint32_t e = s + 1; e <= num_ops; ++e)
+    {
+      for (uint32_t b = s; b < e; ++b)
+      {
+        const auto &prev = plans[s - 1][b];
+        Plan plan;
+        plan.max_cost = std::max(prev.max_cost, stage_cost(b, e));
+        plan.bytes = prev.bytes + cuts[b];
+        plan.begin = b;
+        if (is_better(plan, plans[s][e]))
+          plans[s][e] = plan;
+      }
+    }
+  }
+
+  uint32_t end = num_ops;
+  for (uint32_t s = num_stages; s-- > 0;)
+  {
+    const auto begin = plans[s][end].begin;
+    const auto &group = partition.groups.at(s);
+    INFO(l) << "Stage " << s << " (" << group << "): " << (end - begin) << " ops, cost "
+            << stage_cost(begin, end) << ", received " << cuts[begin] << " bytes" << std::endl;
+
+    for (uint32_t p = begin; p < end; ++p)
+      partition.byopnames[ops[p]->name()] = group;
+    end = begin;
+  }
+  assert(end == 0);
+}
+
+} // namespace luci
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionCost.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+class SqrtChainGraphlet
+{
+public:
+  SqrtChainGraphlet() = default;
+
+public:
+  void init(loco::Graph *g, const ShapeU32 input_shape)
+  {
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      _sqrts[i] = g->nodes()->create<luci::CircleSqrt>();
+      _sqrts[i]->dtype(loco::DataType::S32);
+      _sqrts[i]->shape(input_shape);
+      _sqrts[i]->name("sqrt" + std::to_string(i));
+    }
+  }
+
+protected:
+  luci::CircleSqrt *_sqrts[4] = {nullptr, nullptr, nullptr, nullptr};
+};
+
+class SqrtChainGraph : public TestIOGraph, public SqrtChainGraphlet
+{
+public:
+  SqrtChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+    SqrtChainGraphlet::init(g(), shape);
+
+    _sqrts[0]->x(input());
+    for (uint32_t i = 1; i < 4; ++i)
+      _sqrts[i]->x(_sqrts[i - 1]);
+
+    output()->from(_sqrts[3]);
+  }
+};
+
+} // namespace
+
+TEST(PartitionCostTest, balanced)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  luci::PartitionCost cost;
+  cost.byopcodes["SQRT"] = 1.0;
+  cost.byopnames["sqrt3"] = 3.0;
+
+  luci::assign_by_cost(&module, cost, pt);
+
+  ASSERT_EQ(4, pt.byopnames.size());
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+
+  auto pms = luci::apply(&module, pt);
+
+  ASSERT_EQ(2, pms.pmodules.size());
+}
+
+TEST(PartitionCostTest, default_cost)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  luci::PartitionCost cost;
+  cost.transfer_cost = 0.01;
+
+  luci::assign_by_cost(&module, cost, pt);
+
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, more_groups_than_ops)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B", "C", "D", "E"};
+  pt.default_group = "A";
+
+  luci::PartitionCost cost;
+
+  luci::assign_by_cost(&module, cost, pt);
+
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("C", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("D", pt.byopnames.at("sqrt3"));
+}
+
+TEST(PartitionCostTest, no_group_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::assign_by_cost(&module, cost, pt));
+}
+
+TEST(PartitionCostTest, multiple_subgraphs_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+  module.add(loco::make_graph());
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::assign_by_cost(&module, cost, pt));
+}
@@ -93,6 +93,9 @@ std::unique_ptr<luci::PGroups> produce_pgroups(const luci::Module *source,
       auto it = partition.byopcodes.find(opcodename);
       if (it != partition.byopcodes.end())
         group = it->second;
+      auto nit = partition.byopnames.find(node->name());
+      if (nit != partition.byopnames.end())
+        group = nit->second;
 
       INFO(l) << "Op: " << node->name() << ": " << opcodename << ", " << node << ", " << group
               << std::endl;
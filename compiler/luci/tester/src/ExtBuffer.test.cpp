@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <luci/CircleExporter.h>
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/test/TestIOGraph.h>
+
+#include <mio/circle/schema_generated.h>
+#include <oops/UserExn.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ * @brief Graph of output = (input + large) + small, where large is a page or larger
+ */
+class AddConstGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({2, 1024}, {2, 1024});
+
+    _large = createConst("large", {2, 1024}, 1.0f);
+    _small = createConst("small", {1}, -3.0f);
+
+    auto add_large = createAdd("add_large", input(), _large);
+    auto add_small = createAdd("add_small", add_large, _small);
+    output()->from(add_small);
+  }
+
+public:
+  luci::CircleConst *large(void) { return _large; }
+  luci::CircleConst *small(void) { return _small; }
+
+private:
+  luci::CircleConst *createConst(const std::string &name, const ShapeU32 shape, float first)
+  {
+    auto node = g()->nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape(shape);
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->name(name);
+
+    const auto size = num_elements(shape);
+    node->size<loco::DataType::FLOAT32>(size);
+    for (uint32_t i = 0; i < size; ++i)
+      node->at<loco::DataType::FLOAT32>(i) = first + static_cast<float>(i);
+    return node;
+  }
+
+  luci::CircleAdd *createAdd(const std::string &name, loco::Node *x, loco::Node *y)
+  {
+    auto node = g()->nodes()->create<luci::CircleAdd>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape({2, 1024});
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    node->name(name);
+    node->x(x);
+    node->y(y);
+    return node;
+  }
+
+private:
+  luci::CircleConst *_large = nullptr;
+  luci::CircleConst *_small = nullptr;
+};
+
+class MemoryExpContract : public luci::CircleExporter::Contract
+{
+public:
+  MemoryExpContract(luci::Module *module, std::vector<char> &data) : _module(module), _data(data)
+  {
+    // NOTHING TO DO
+  }
+
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; }
+  bool ext_buffer(void) const final { return true; }
+
+public:
+  bool store(const char *ptr, const size_t size) const final
+  {
+    _data.assign(ptr, ptr + size);
+    return true;
+  }
+
+  bool store_ext(const char *ptr, const size_t size) const final
+  {
+    _data.insert(_data.end(), ptr, ptr + size);
+    return true;
+  }
+
+private:
+  luci::Module *_module;
+  std::vector<char> &_data;
+};
+
+const luci::CircleConst *findConst(luci::Module *module, const std::string &name)
+{
+  for (auto node : loco::all_nodes(module->graph()))
+  {
+    auto circle_const = dynamic_cast<luci::CircleConst *>(node);
+    if (circle_const != nullptr && circle_const->name() == name)
+      return circle_const;
+  }
+  return nullptr;
+}
+
+void expectSameData(const luci::CircleConst *expected, const luci::CircleConst *actual)
+{
+  ASSERT_NE(nullptr, actual);
+  ASSERT_EQ(expected->size<loco::DataType::FLOAT32>(), actual->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected->size<loco::DataType::FLOAT32>(); ++i)
+    ASSERT_EQ(expected->at<loco::DataType::FLOAT32>(i), actual->at<loco::DataType::FLOAT32>(i));
+}
+
+class ExtBufferTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _graph.init();
+    _large = _graph.large();
+    _small = _graph.small();
+    _graph.transfer_to(&_module);
+
+    luci::CircleExporter exporter;
+    MemoryExpContract contract(&_module, _data);
+    ASSERT_TRUE(exporter.invoke(&contract));
+  }
+
+  const uint8_t *data(void) const { return reinterpret_cast<const uint8_t *>(_data.data()); }
+
+  // Buffers of data outside of the flatbuffer
+  std::vector<circle::Buffer *> extBuffers(void)
+  {
+    std::vector<circle::Buffer *> buffers;
+    auto model = circle::GetMutableModel(_data.data());
+    for (uint32_t i = 0; i < model->buffers()->size(); ++i)
+    {
+      auto buffer = model->mutable_buffers()->GetMutableObject(i);
+      if (buffer->offset() > 1)
+        buffers.push_back(buffer);
+    }
+    return buffers;
+  }
+
+protected:
+  AddConstGraph _graph;
+  luci::Module _module;
+  luci::CircleConst *_large = nullptr;
+  luci::CircleConst *_small = nullptr;
+  std::vector<char> _data;
+};
+
+} // namespace
+
+TEST_F(ExtBufferTest, export_aligned)
+{
+  auto buffers = extBuffers();
+  ASSERT_EQ(2, buffers.size());
+
+  for (auto buffer : buffers)
+  {
+    // Data is only outside of the flatbuffer, aligned and patched in
+    ASSERT_TRUE(buffer->data() == nullptr || buffer->data()->size() == 0);
+    ASSERT_EQ(0, buffer->offset() % 16);
+    ASSERT_LE(buffer->offset() + buffer->size(), _data.size());
+
+    const luci::CircleConst *node = nullptr;
+    if (buffer->size() == _large->size<loco::DataType::FLOAT32>() * sizeof(float))
+    {
+      ASSERT_EQ(0, buffer->offset() % 4096);
+      node = _large;
+    }
+    else
+    {
+      ASSERT_EQ(_small->size<loco::DataType::FLOAT32>() * sizeof(float), buffer->size());
+      node = _small;
+    }
+    ASSERT_EQ(0, std::memcmp(data() + buffer->offset(), &node->at<loco::DataType::FLOAT32>(0),
+                             buffer->size()));
+  }
+}
+
+TEST_F(ExtBufferTest, import_same_constants)
+{
+  luci::Importer importer;
+  auto module = importer.importModule(data(), _data.size(), nullptr);
+  ASSERT_NE(nullptr, module);
+
+  expectSameData(_large, findConst(module.get(), "large"));
+  expectSameData(_small, findConst(module.get(), "small"));
+}
+
+TEST_F(ExtBufferTest, import_out_of_range_offset_NEG)
+{
+  for (auto buffer : extBuffers())
+    ASSERT_TRUE(buffer->mutate_offset(_data.size()));
+
+  luci::Importer importer;
+  EXPECT_THROW(importer.importModule(data(), _data.size(), nullptr), oops::UserExn);
+}
+
+TEST_F(ExtBufferTest, import_out_of_range_size_NEG)
+{
+  for (auto buffer : extBuffers())
+    ASSERT_TRUE(buffer->mutate_size(_data.size()));
+
+  luci::Importer importer;
+  EXPECT_THROW(importer.importModule(data(), _data.size(), nullptr), oops::UserExn);
+}
+
+TEST_F(ExtBufferTest, import_without_data_NEG)
+{
+  luci::Importer importer;
+  EXPECT_THROW(importer.importModule(circle::GetModel(_data.data())), oops::UserExn);
+}
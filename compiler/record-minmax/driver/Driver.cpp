@@ -76,6 +76,17 @@ int entry(const int argc, char **argv)
     .type(arser::DataType::STR)
     .help("Record mode. percentile (default) or moving_average");
 
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of threads to record input data in parallel (default: 1)");
+
+  arser.add_argument("--num_kernel_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of threads for each interpreter to run kernels with "
+          "(default: number of hardware threads)");
+
   arser.add_argument("--generate_profile_data")
     .nargs(0)
     .required(false)
@@ -102,6 +113,9 @@ int entry(const int argc, char **argv)
   std::string mode("percentile");
   float min_percentile = 1.0;
   float max_percentile = 99.0;
+  int32_t num_threads = 1;
+  // 0 runs kernels with the default number of threads of the interpreter
+  int32_t num_kernel_threads = 0;
 
   if (arser["--min_percentile"])
     min_percentile = arser.get<float>("--min_percentile");
@@ -112,16 +126,29 @@ int entry(const int argc, char **argv)
   if (arser["--mode"])
     mode = arser.get<std::string>("--mode");
 
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+
+  if (arser["--num_kernel_threads"])
+  {
+    num_kernel_threads = arser.get<int32_t>("--num_kernel_threads");
+    if (num_kernel_threads < 1)
+      throw std::runtime_error("The number of threads must be positive");
+  }
+
   if (mode != "percentile" && mode != "moving_average")
     throw std::runtime_error("Unsupported mode");
 
+  if (num_threads < 1)
+    throw std::runtime_error("The number of threads must be positive");
+
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
   RecordMinMax rmm;
 
   // Initialize interpreter and observer
-  rmm.initialize(input_model_path);
+  rmm.initialize(input_model_path, num_threads, num_kernel_threads);
 
   if (arser["--input_data"])
   {
@@ -20,16 +20,25 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
-#include <vector>
+#include "StreamingStats.h"
+
+#include <cstdint>
 #include <unordered_map>
 
 namespace record_minmax
 {
 
-struct MinMaxVectors
+// Weight and batch size of moving average mode
+constexpr float MOVING_AVERAGE_ALPHA = 0.9;
+constexpr uint32_t MOVING_AVERAGE_BATCH_SIZE = 16;
+
+// Statistics of min/max of a node over records, whose memory does not grow with records
+struct MinMaxStats
 {
-  std::vector<float> min_vector;
-  std::vector<float> max_vector;
+  PercentileDigest min_digest;
+  PercentileDigest max_digest;
+  MovingAverage min_average{MOVING_AVERAGE_ALPHA, MOVING_AVERAGE_BATCH_SIZE, true};
+  MovingAverage max_average{MOVING_AVERAGE_ALPHA, MOVING_AVERAGE_BATCH_SIZE, false};
 };
 
 class MinMaxMap
@@ -38,18 +47,37 @@ public:
   // Record min/max of node
   void recordMinMax(const luci::CircleNode *node, float min, float max)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.push_back(min);
-    vectors.max_vector.push_back(max);
+    MinMaxStats &stats = _minmax_map[node];
+    stats.min_digest.add(min);
+    stats.max_digest.add(max);
+    stats.min_average.add(min);
+    stats.max_average.add(max);
   }
 
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
+  // Append min/max recorded in other map after the ones recorded in this map
+  // NOTE This map should have recorded a multiple of MOVING_AVERAGE_BATCH_SIZE records
+  void append(const MinMaxMap &other)
+  {
+    for (const auto &item : other._minmax_map)
+    {
+      MinMaxStats &stats = _minmax_map[item.first];
+      const MinMaxStats &other_stats = item.second;
+      stats.min_digest.merge(other_stats.min_digest);
+      stats.max_digest.merge(other_stats.max_digest);
+      stats.min_average.merge(other_stats.min_average);
+      stats.max_average.merge(other_stats.max_average);
+    }
+  }
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxStats> *getMap() const
   {
     return &_minmax_map;
   }
 
+  std::unordered_map<const luci::CircleNode *, MinMaxStats> *getMap() { return &_minmax_map; }
+
 private:
-  std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  std::unordered_map<const luci::CircleNode *, MinMaxStats> _minmax_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
@@ -65,6 +93,8 @@ public:
 
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  MinMaxMap *mutableMinMaxData() { return &_minmax_data; }
+
 private:
   MinMaxMap _minmax_data;
 };
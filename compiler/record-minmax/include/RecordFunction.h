@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 
+#ifndef __RECORD_MINMAX_RECORD_FUNCTION_H__
+#define __RECORD_MINMAX_RECORD_FUNCTION_H__
+
 #include <vector>
 #include <cassert>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
 #include <stdexcept>
 
@@ -27,34 +31,37 @@ namespace record_minmax
 /**
  * @brief  getNthPercentile calculates the n-th percentile of input vector (0.0 <= n <= 100.0)
  *         linear interpolation is used when the desired percentile lies between two data points
+ * @note   The vector is reordered in place instead of being copied
  */
-float getNthPercentile(std::vector<float> &vector, float percentile)
+inline float getNthPercentile(std::vector<float> &vector, float percentile)
 {
   if (percentile < 0 || percentile > 100)
     throw std::runtime_error("Percentile must be ranged from 0 to 100");
 
+  if (vector.empty())
+    throw std::runtime_error("Percentile must take a non-empty vector as an argument");
+
   if (percentile == 0.0)
-    return vector.front();
+    return *std::min_element(vector.begin(), vector.end());
 
   if (percentile == 100.0)
-    return vector.back();
-
-  if (vector.empty())
-    throw std::runtime_error("Percentile must take a non-empty vector as an argument");
+    return *std::max_element(vector.begin(), vector.end());
 
   if (vector.size() == 1)
     return vector[0];
 
-  std::vector<float> copy;
-  copy.assign(vector.begin(), vector.end());
-  std::sort(copy.begin(), copy.end());
+  int index = static_cast<int>(std::floor((vector.size() - 1) * percentile / 100.0));
 
-  int index = static_cast<int>(std::floor((copy.size() - 1) * percentile / 100.0));
+  // Only the index'th and (index + 1)'th smallest values are needed, so sorting is not necessary
+  auto nth = vector.begin() + index;
+  std::nth_element(vector.begin(), nth, vector.end());
+  float lower = *nth;
+  float upper = *std::min_element(nth + 1, vector.end());
 
-  float percent_i = static_cast<float>(index) / static_cast<float>(copy.size() - 1);
+  float percent_i = static_cast<float>(index) / static_cast<float>(vector.size() - 1);
   float fraction =
-    (percentile / 100.0 - percent_i) / ((index + 1.0) / (copy.size() - 1.0) - percent_i);
-  float res = copy[index] + fraction * (copy[index + 1] - copy[index]);
+    (percentile / 100.0 - percent_i) / ((index + 1.0) / (vector.size() - 1.0) - percent_i);
+  float res = lower + fraction * (upper - lower);
   return res;
 }
 
@@ -62,8 +69,8 @@ float getNthPercentile(std::vector<float> &vector, float percentile)
  * @brief  getMovingAverage calculates the weighted moving average of input vector
  *         The initial value is the minimum (or maximum) value of the first batch of the vector
  */
-float getMovingAverage(const std::vector<float> &vector, const float alpha,
-                       const uint8_t batch_size, bool is_min)
+inline float getMovingAverage(const std::vector<float> &vector, const float alpha,
+                              const uint8_t batch_size, bool is_min)
 {
   assert(!vector.empty());
   assert(alpha >= 0.0 && alpha <= 1.0);
@@ -100,3 +107,5 @@ float getMovingAverage(const std::vector<float> &vector, const float alpha,
 }
 
 } // namespace record_minmax
+
+#endif // __RECORD_MINMAX_RECORD_FUNCTION_H__
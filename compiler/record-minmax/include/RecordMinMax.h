@@ -23,6 +23,7 @@
 #include "MinMaxObserver.h"
 
 #include <memory>
+#include <vector>
 
 namespace record_minmax
 {
@@ -34,7 +35,10 @@ public:
 
   ~RecordMinMax() = default;
 
-  void initialize(const std::string &input_model_path);
+  // Create num_threads interpreters, each of which records a disjoint set of input data
+  // and runs kernels with num_kernel_threads threads, or the default of the interpreter if it is 0
+  void initialize(const std::string &input_model_path, uint32_t num_threads = 1,
+                  uint32_t num_kernel_threads = 0);
 
   void profileData(const std::string &mode, const std::string &input_data_path,
                    float min_percentile, float max_percentile);
@@ -44,10 +48,14 @@ public:
 
   void saveModel(const std::string &output_model_path);
 
+private:
+  // Append min/max recorded by the other workers to the ones of the first worker
+  void mergeMinMax(uint32_t num_workers);
+
 private:
   std::unique_ptr<luci::Module> _module;
-  std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
-  std::unique_ptr<MinMaxObserver> _observer;
+  std::vector<std::unique_ptr<luci_interpreter::Interpreter>> _interpreters;
+  std::vector<std::unique_ptr<MinMaxObserver>> _observers;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_RECORD_SHARDS_H__
+#define __RECORD_MINMAX_RECORD_SHARDS_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  recordShards splits records into contiguous shards and calls
+ *         record(worker, begin, end, failed) for each shard on its own thread
+ *
+ * Every shard but the last one has a multiple of 'granularity' records.
+ *
+ * @return the number of workers used, which is not larger than the number of records
+ *
+ * @note   Appending the results of workers in the order of workers keeps the order of records.
+ *         The first exception thrown by a worker is rethrown after all workers finish, and
+ *         'failed' is set meanwhile so that the others can stop early.
+ */
+template <typename RecordFn>
+uint32_t recordShards(uint32_t max_workers, int32_t num_records, RecordFn record,
+                      int32_t granularity = 1)
+{
+  assert(granularity > 0);
+  std::atomic<bool> failed{false};
+
+  const int64_t num_units = (static_cast<int64_t>(num_records) + granularity - 1) / granularity;
+  const auto num_workers =
+    static_cast<uint32_t>(std::max<int64_t>(1, std::min<int64_t>(max_workers, num_units)));
+  if (num_workers == 1)
+  {
+    record(0, 0, num_records, failed);
+    return num_workers;
+  }
+
+  // First record of the shard of the given worker
+  auto shard_begin = [&](uint32_t worker) {
+    return static_cast<int32_t>(
+      std::min<int64_t>(num_units * worker / num_workers * granularity, num_records));
+  };
+
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> errors(num_workers);
+  for (uint32_t worker = 0; worker < num_workers; ++worker)
+  {
+    const int32_t begin = shard_begin(worker);
+    const int32_t end = shard_begin(worker + 1);
+    threads.emplace_back([&, worker, begin, end]() {
+      try
+      {
+        record(worker, begin, end, failed);
+      }
+      catch (...)
+      {
+        errors[worker] = std::current_exception();
+        failed = true;
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+  return num_workers;
+}
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_RECORD_SHARDS_H__
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_STREAMING_STATS_H__
+#define __RECORD_MINMAX_STREAMING_STATS_H__
+
+#include "RecordFunction.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  PercentileDigest estimates percentiles of a stream of values in bounded memory
+ *
+ * Up to 'exact_limit' values are kept as they are, and their percentiles are the same as
+ * getNthPercentile. Beyond that, the values are summarized in a merging t-digest, which keeps
+ * about 'compression' / 2 centroids and is more accurate at the tails than at the median.
+ */
+class PercentileDigest
+{
+public:
+  explicit PercentileDigest(uint32_t compression = 500, uint32_t exact_limit = 1024)
+    : _compression(compression), _exact_limit(exact_limit)
+  {
+    assert(compression > 0 && exact_limit > 0);
+  }
+
+  void add(float value)
+  {
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+    _buffer.push_back(value);
+    if (_buffer.size() > _exact_limit)
+      compress();
+  }
+
+  // Add the values summarized in other
+  void merge(const PercentileDigest &other)
+  {
+    _centroids.insert(_centroids.end(), other._centroids.begin(), other._centroids.end());
+    for (float value : other._buffer)
+      add(value);
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+    if (!_centroids.empty())
+      compress();
+  }
+
+  // Return the n-th percentile of the values (0.0 <= n <= 100.0)
+  float percentile(float percentile)
+  {
+    if (percentile < 0 || percentile > 100)
+      throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+    if (_centroids.empty())
+      return getNthPercentile(_buffer, percentile);
+
+    compress();
+    if (percentile == 0.0)
+      return _min;
+    if (percentile == 100.0)
+      return _max;
+
+    // Each centroid is regarded to be at the middle of its weight, between the min and the max
+    const double rank = percentile / 100.0 * _total;
+    double prev_center = 0.0;
+    double prev_mean = _min;
+    double cumulative = 0.0;
+    for (const auto &centroid : _centroids)
+    {
+      const double center = cumulative + centroid.weight / 2.0;
+      if (rank < center)
+        return prev_mean + (rank - prev_center) / (center - prev_center) *
+                             (centroid.mean - prev_mean);
+      prev_center = center;
+      prev_mean = centroid.mean;
+      cumulative += centroid.weight;
+    }
+    return prev_mean + (rank - prev_center) / (_total - prev_center) * (_max - prev_mean);
+  }
+
+private:
+  struct Centroid
+  {
+    double mean;
+    double weight;
+  };
+
+  // Scale function of t-digest, which limits the weight of centroids near the tails
+  double scale(double q) const
+  {
+    const double pi = std::acos(-1.0);
+    return _compression / (2.0 * pi) * std::asin(2.0 * q - 1.0);
+  }
+
+  void compress()
+  {
+    std::vector<Centroid> points;
+    points.reserve(_centroids.size() + _buffer.size());
+    points.insert(points.end(), _centroids.begin(), _centroids.end());
+    for (float value : _buffer)
+      points.push_back({value, 1.0});
+    _buffer.clear();
+    _centroids.clear();
+    if (points.empty())
+      return;
+
+    std::sort(points.begin(), points.end(),
+              [](const Centroid &lhs, const Centroid &rhs) { return lhs.mean < rhs.mean; });
+
+    _total = 0.0;
+    for (const auto &point : points)
+      _total += point.weight;
+
+    // Merge neighbouring points while the centroid spans at most one unit of the scale
+    double weight_before = 0.0;
+    double scale_before = scale(0.0);
+    Centroid current = points.front();
+    for (size_t i = 1; i < points.size(); ++i)
+    {
+      const auto &point = points[i];
+      const double q = (weight_before + current.weight + point.weight) / _total;
+      if (scale(q) - scale_before <= 1.0)
+      {
+        current.weight += point.weight;
+        current.mean += (point.mean - current.mean) * point.weight / current.weight;
+      }
+      else
+      {
+        weight_before += current.weight;
+        scale_before = scale(weight_before / _total);
+        _centroids.push_back(current);
+        current = point;
+      }
+    }
+    _centroids.push_back(current);
+  }
+
+private:
+  uint32_t _compression;
+  uint32_t _exact_limit;
+  // Values not summarized yet
+  std::vector<float> _buffer;
+  // Centroids sorted by mean, if any value has been summarized
+  std::vector<Centroid> _centroids;
+  double _total = 0.0;
+  float _min = std::numeric_limits<float>::max();
+  float _max = std::numeric_limits<float>::lowest();
+};
+
+/**
+ * @brief  MovingAverage calculates the same as getMovingAverage for a stream of values
+ *
+ * The weighted moving average of batches b(0), ..., b(n - 1) is
+ *   alpha^n * b(0) + sum of alpha^(n - 1 - j) * (1 - alpha) * b(j)
+ * so that only the first batch, the sum and the current batch need to be kept.
+ */
+class MovingAverage
+{
+public:
+  MovingAverage(float alpha, uint32_t batch_size, bool is_min)
+    : _alpha(alpha), _batch_size(batch_size), _is_min(is_min)
+  {
+    assert(alpha >= 0.0 && alpha <= 1.0);
+    assert(batch_size > 0);
+  }
+
+  void add(float value)
+  {
+    if (_batch_count == 0)
+      _batch_value = value;
+    else
+      _batch_value = _is_min ? std::min(_batch_value, value) : std::max(_batch_value, value);
+
+    if (++_batch_count == _batch_size)
+      flushBatch();
+  }
+
+  // Append the values of other after the values of this
+  // NOTE Batches must not span the two, so this should have no partial batch
+  void merge(const MovingAverage &other)
+  {
+    if (_batch_count != 0)
+      throw std::runtime_error("Moving average cannot be merged after a partial batch");
+
+    if (_num_batches == 0)
+    {
+      _first = other._first;
+      _sum = other._sum;
+    }
+    else
+    {
+      _sum = _sum * std::pow(_alpha, other._num_batches) + other._sum;
+    }
+    _num_batches += other._num_batches;
+    _batch_value = other._batch_value;
+    _batch_count = other._batch_count;
+  }
+
+  float value() const
+  {
+    if (_num_batches == 0 && _batch_count == 0)
+      throw std::runtime_error("Moving average must take at least one value");
+
+    // The last partial batch counts as a batch
+    MovingAverage copy = *this;
+    if (copy._batch_count != 0)
+      copy.flushBatch();
+    return copy._sum + std::pow(_alpha, copy._num_batches) * copy._first;
+  }
+
+private:
+  void flushBatch()
+  {
+    if (_num_batches == 0)
+      _first = _batch_value;
+    _sum = _sum * _alpha + _batch_value * (1.0 - _alpha);
+    _num_batches++;
+    _batch_count = 0;
+  }
+
+private:
+  double _alpha;
+  uint32_t _batch_size;
+  bool _is_min;
+  double _first = 0.0;
+  double _sum = 0.0;
+  uint32_t _num_batches = 0;
+  float _batch_value = 0.0f;
+  uint32_t _batch_count = 0;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_STREAMING_STATS_H__
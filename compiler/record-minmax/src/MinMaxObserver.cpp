@@ -18,6 +18,9 @@
 
 #include <luci/IR/CircleOpcode.h>
 
+#include <algorithm>
+#include <limits>
+
 using DataType = luci_interpreter::DataType;
 
 namespace record_minmax
@@ -58,10 +61,14 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-  auto minmax = std::minmax_element(buf.begin(), buf.end());
-  float min = *minmax.first;
-  float max = *minmax.second;
+  // Find min/max in a single pass over the tensor, without copying it
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  for (int32_t i = 0; i < num_elements; ++i)
+  {
+    min = std::min(min, data[i]);
+    max = std::max(max, data[i]);
+  }
 
   _minmax_data.recordMinMax(node, min, max);
 }
@@ -15,7 +15,7 @@
  */
 
 #include "RecordMinMax.h"
-#include "RecordFunction.h"
+#include "RecordShards.h"
 #include "MinMaxObserver.h"
 #include "HDF5Importer.h"
 
@@ -25,11 +25,13 @@
 #include <luci/IR/CircleQuantParam.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <fstream>
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <mutex>
 #include <random>
 
 using Shape = luci_interpreter::Shape;
@@ -72,22 +74,22 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
 void update_quantparam(record_minmax::MinMaxObserver *observer, const std::string &mode,
                        float min_percentile, float max_percentile)
 {
-  auto minmax_map = observer->minMaxData()->getMap();
+  auto minmax_map = observer->mutableMinMaxData()->getMap();
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
+    auto &minmax = iter->second;
 
     float min{0.0f}, max{0.0f};
     if (mode == "percentile")
     {
-      min = record_minmax::getNthPercentile(minmax.min_vector, min_percentile);
-      max = record_minmax::getNthPercentile(minmax.max_vector, max_percentile);
+      min = minmax.min_digest.percentile(min_percentile);
+      max = minmax.max_digest.percentile(max_percentile);
     }
     else if (mode == "moving_average")
     {
-      min = record_minmax::getMovingAverage(minmax.min_vector, 0.9, 16, true);
-      max = record_minmax::getMovingAverage(minmax.max_vector, 0.9, 16, false);
+      min = minmax.min_average.value();
+      max = minmax.max_average.value();
     }
     assert(mode == "percentile" || mode == "moving_average");
     auto quantparam = std::make_unique<luci::CircleQuantParam>();
@@ -106,7 +108,8 @@ void update_quantparam(record_minmax::MinMaxObserver *observer, const std::strin
 namespace record_minmax
 {
 
-void RecordMinMax::initialize(const std::string &input_model_path)
+void RecordMinMax::initialize(const std::string &input_model_path, uint32_t num_threads,
+                              uint32_t num_kernel_threads)
 {
   // Load model from the file
   std::ifstream fs(input_model_path, std::ifstream::binary);
@@ -132,12 +135,22 @@ void RecordMinMax::initialize(const std::string &input_model_path)
     throw std::runtime_error("ERROR: Failed to load '" + input_model_path + "'");
   }
 
-  // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  if (num_threads == 0)
+    throw std::runtime_error("The number of threads must be positive.");
 
-  _observer = std::make_unique<MinMaxObserver>();
+  // Initialize interpreters and observers
+  for (uint32_t i = 0; i < num_threads; ++i)
+  {
+    auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+    if (num_kernel_threads > 0)
+      interpreter->setNumThreads(num_kernel_threads);
+    auto observer = std::make_unique<MinMaxObserver>();
+
+    interpreter->attachObserver(observer.get());
 
-  _interpreter->attachObserver(_observer.get());
+    _interpreters.push_back(std::move(interpreter));
+    _observers.push_back(std::move(observer));
+  }
 }
 
 void RecordMinMax::profileData(const std::string &mode, const std::string &input_data_path,
@@ -157,42 +170,61 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-    {
-      if (num_inputs != importer.numInputs(record_idx))
-        throw std::runtime_error("Wrong number of inputs.");
-
-      if (record_idx % 100 == 0)
-        std::cout << "Recording " << record_idx << "'th data" << std::endl;
+    // HDF5 library is not guaranteed to be thread-safe, so the importer is used by one thread at
+    // a time. Interpreters run in parallel.
+    std::mutex importer_mutex;
+    int32_t num_read_records = 0;
 
-      for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    // Record [begin, end) records with the interpreter of the given worker
+    auto record = [&](uint32_t worker, int32_t begin, int32_t end,
+                      const std::atomic<bool> &failed) {
+      auto interpreter = _interpreters[worker].get();
+      for (int32_t record_idx = begin; record_idx < end && !failed; record_idx++)
       {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        std::vector<char> input_data(getTensorSize(input_node));
-
-        if (!is_raw_data)
-        {
-          DataType dtype;
-          Shape shape(input_node->rank());
-          importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
         {
-          // Skip type/shape check for raw data
-          importer.readTensor(record_idx, input_idx, input_data.data());
+          std::lock_guard<std::mutex> lock(importer_mutex);
+
+          if (num_inputs != importer.numInputs(record_idx))
+            throw std::runtime_error("Wrong number of inputs.");
+
+          if (num_read_records % 100 == 0)
+            std::cout << "Recording " << num_read_records << "'th data" << std::endl;
+          num_read_records++;
+
+          for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+          {
+            const auto *input_node =
+              loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+            assert(input_node->index() == input_idx);
+
+            // Read data from file directly to the interpreter input
+            void *input_data = interpreter->getInputTensorBuffer(input_node);
+
+            if (!is_raw_data)
+            {
+              DataType dtype;
+              Shape shape(input_node->rank());
+              importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data);
+
+              // Check the type and the shape of the input data is valid
+              verifyTypeShape(input_node, dtype, shape);
+            }
+            else
+            {
+              // Skip type/shape check for raw data
+              importer.readTensor(record_idx, input_idx, input_data);
+            }
+          }
         }
 
-        // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-        //       We can redcue the copy by directly writing data from file to interpreter inputs
-        _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+        interpreter->interpret();
       }
+    };
 
-      _interpreter->interpret();
-    }
+    // Moving average is merged by batches, which should not span workers
+    const auto num_workers =
+      recordShards(_interpreters.size(), num_records, record, MOVING_AVERAGE_BATCH_SIZE);
+    mergeMinMax(num_workers);
 
     std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
   }
@@ -202,7 +234,7 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     throw std::runtime_error("HDF5 error occurred.");
   }
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(_observers[0].get(), mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float min_percentile,
@@ -218,10 +250,10 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
   std::mt19937 gen(rd());
   std::uniform_real_distribution<> dist(-5, 5);
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+  // Generate the records in order first, so that they do not depend on the number of workers
+  std::vector<std::vector<std::vector<float>>> records(num_records);
+  for (auto &inputs : records)
   {
-    std::cout << "Recording " << record_idx << "'th data" << std::endl;
-
     for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
     {
       const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
@@ -245,18 +277,48 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
       for (auto &iter : input_data)
         iter = static_cast<float>(dist(gen));
 
-      // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-      //       We can redcue the copy by directly writing data from file to interpreter inputs
-      _interpreter->writeInputTensor(input_node, input_data.data(),
-                                     input_data.size() * sizeof(float));
+      inputs.emplace_back(std::move(input_data));
     }
-
-    _interpreter->interpret();
   }
 
+  std::mutex print_mutex;
+
+  // Record [begin, end) records with the interpreter of the given worker
+  auto record = [&](uint32_t worker, int32_t begin, int32_t end, const std::atomic<bool> &failed) {
+    auto interpreter = _interpreters[worker].get();
+    for (int32_t record_idx = begin; record_idx < end && !failed; record_idx++)
+    {
+      {
+        std::lock_guard<std::mutex> lock(print_mutex);
+        std::cout << "Recording " << record_idx << "'th data" << std::endl;
+      }
+
+      for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+      {
+        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        const auto &input_data = records[record_idx][input_idx];
+        interpreter->writeInputTensor(input_node, input_data.data(),
+                                      input_data.size() * sizeof(float));
+      }
+
+      interpreter->interpret();
+    }
+  };
+
+  // Moving average is merged by batches, which should not span workers
+  const auto num_workers =
+    recordShards(_interpreters.size(), num_records, record, MOVING_AVERAGE_BATCH_SIZE);
+  mergeMinMax(num_workers);
+
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(_observers[0].get(), mode, min_percentile, max_percentile);
+}
+
+void RecordMinMax::mergeMinMax(uint32_t num_workers)
+{
+  for (uint32_t worker = 1; worker < num_workers; ++worker)
+    _observers[0]->mutableMinMaxData()->append(*_observers[worker]->minMaxData());
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
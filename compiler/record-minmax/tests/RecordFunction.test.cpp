@@ -85,6 +85,17 @@ TEST(GetNthPercentileTest, FloatWithNegative)
   SUCCEED();
 }
 
+TEST(GetNthPercentileTest, Duplicated)
+{
+  std::vector<float> input{3, 1, 2, 3, 1, 2, 3, 1, 2, 3};
+
+  EXPECT_FLOAT_NEAR(1, getNthPercentile(input, 10));
+  EXPECT_FLOAT_NEAR(2, getNthPercentile(input, 50));
+  EXPECT_FLOAT_NEAR(3, getNthPercentile(input, 90));
+
+  SUCCEED();
+}
+
 TEST(GetNthPercentileTest, SigleElement)
 {
   std::vector<float> input{33};
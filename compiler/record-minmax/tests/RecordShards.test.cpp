@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordShards.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+namespace
+{
+
+// Min/max of each record, which is recorded by workers like MinMaxObserver does
+struct MinMax
+{
+  std::vector<float> min_vector;
+  std::vector<float> max_vector;
+};
+
+MinMax recordMinMax(uint32_t max_workers, const std::vector<std::vector<float>> &records)
+{
+  std::vector<MinMax> observers(max_workers);
+  auto record = [&](uint32_t worker, int32_t begin, int32_t end, const std::atomic<bool> &) {
+    for (int32_t record_idx = begin; record_idx < end; record_idx++)
+    {
+      const auto &data = records[record_idx];
+      observers[worker].min_vector.push_back(*std::min_element(data.begin(), data.end()));
+      observers[worker].max_vector.push_back(*std::max_element(data.begin(), data.end()));
+    }
+  };
+
+  const auto num_workers = recordShards(max_workers, records.size(), record);
+  EXPECT_LE(num_workers, max_workers);
+
+  // Merge in the order of workers as RecordMinMax does
+  MinMax &merged = observers[0];
+  for (uint32_t worker = 1; worker < num_workers; ++worker)
+  {
+    merged.min_vector.insert(merged.min_vector.end(), observers[worker].min_vector.begin(),
+                             observers[worker].min_vector.end());
+    merged.max_vector.insert(merged.max_vector.end(), observers[worker].max_vector.begin(),
+                             observers[worker].max_vector.end());
+  }
+  return merged;
+}
+
+std::vector<std::vector<float>> makeRecords(int32_t num_records)
+{
+  std::vector<std::vector<float>> records(num_records);
+  for (int32_t i = 0; i < num_records; ++i)
+  {
+    for (int32_t j = 0; j < 16; ++j)
+      records[i].push_back(static_cast<float>((i * 37 + j * 11) % 101) - 50.0f);
+  }
+  return records;
+}
+
+} // namespace
+
+TEST(RecordShardsTest, MergeEqualsSingle)
+{
+  const auto records = makeRecords(53);
+  auto single = recordMinMax(1, records);
+
+  for (uint32_t max_workers : {2, 3, 4, 8})
+  {
+    auto merged = recordMinMax(max_workers, records);
+    EXPECT_EQ(single.min_vector, merged.min_vector);
+    EXPECT_EQ(single.max_vector, merged.max_vector);
+  }
+}
+
+TEST(RecordShardsTest, MoreWorkersThanRecords)
+{
+  const auto records = makeRecords(3);
+  auto single = recordMinMax(1, records);
+  auto merged = recordMinMax(8, records);
+
+  EXPECT_EQ(single.min_vector, merged.min_vector);
+  EXPECT_EQ(single.max_vector, merged.max_vector);
+}
+
+TEST(RecordShardsTest, Granularity)
+{
+  std::vector<std::pair<int32_t, int32_t>> shards(4);
+  auto record = [&](uint32_t worker, int32_t begin, int32_t end, const std::atomic<bool> &) {
+    shards[worker] = {begin, end};
+  };
+
+  ASSERT_EQ(4, recordShards(4, 53, record, 8));
+  EXPECT_EQ(0, shards[0].first);
+  for (uint32_t worker = 0; worker < 4; ++worker)
+  {
+    EXPECT_EQ(0, shards[worker].first % 8);
+    if (worker > 0)
+    {
+      EXPECT_EQ(shards[worker - 1].second, shards[worker].first);
+    }
+  }
+  EXPECT_EQ(53, shards[3].second);
+
+  // Not more workers than units of records
+  EXPECT_EQ(2, recordShards(4, 9, record, 8));
+}
+
+TEST(RecordShardsTest, Error_NEG)
+{
+  auto record = [](uint32_t, int32_t begin, int32_t end, const std::atomic<bool> &) {
+    for (int32_t record_idx = begin; record_idx < end; record_idx++)
+    {
+      if (record_idx == 7)
+        throw std::runtime_error("Wrong number of inputs.");
+    }
+  };
+
+  EXPECT_THROW(recordShards(1, 10, record), std::runtime_error);
+  EXPECT_THROW(recordShards(4, 10, record), std::runtime_error);
+}
+
+} // namespace record_minmax
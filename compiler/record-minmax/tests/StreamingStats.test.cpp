@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingStats.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+#define EXPECT_FLOAT_NEAR(exp, val) EXPECT_NEAR(exp, val, 1e-5 + 1e-5 * std::abs(exp))
+
+namespace
+{
+
+std::vector<float> normalValues(uint32_t size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::normal_distribution<float> dist(0.5f, 2.0f);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = dist(gen);
+  return values;
+}
+
+} // namespace
+
+TEST(PercentileDigestTest, Exact)
+{
+  std::vector<float> input{3, 1, 2, 3, 1, 2, 3, 1, 2, 3, 0.5, 7, -4};
+
+  PercentileDigest digest;
+  for (float value : input)
+    digest.add(value);
+
+  for (float percentile : {0.0f, 1.0f, 10.0f, 33.3f, 50.0f, 90.0f, 99.0f, 100.0f})
+  {
+    auto copy = input;
+    EXPECT_FLOAT_NEAR(getNthPercentile(copy, percentile), digest.percentile(percentile));
+  }
+}
+
+TEST(PercentileDigestTest, Accuracy)
+{
+  auto values = normalValues(100000, 1);
+
+  PercentileDigest digest;
+  for (float value : values)
+    digest.add(value);
+
+  // Error relative to the standard deviation
+  for (float percentile : {0.0f, 0.1f, 1.0f, 5.0f, 50.0f, 95.0f, 99.0f, 99.9f, 100.0f})
+  {
+    const float exact = getNthPercentile(values, percentile);
+    EXPECT_NEAR(exact, digest.percentile(percentile), 0.01 * 2.0) << percentile;
+  }
+}
+
+TEST(PercentileDigestTest, Merge)
+{
+  auto values = normalValues(50000, 2);
+
+  std::vector<PercentileDigest> digests(4);
+  for (size_t i = 0; i < values.size(); ++i)
+    digests[i * digests.size() / values.size()].add(values[i]);
+  for (size_t i = 1; i < digests.size(); ++i)
+    digests[0].merge(digests[i]);
+
+  for (float percentile : {0.0f, 1.0f, 50.0f, 99.0f, 100.0f})
+  {
+    const float exact = getNthPercentile(values, percentile);
+    EXPECT_NEAR(exact, digests[0].percentile(percentile), 0.01 * 2.0) << percentile;
+  }
+}
+
+TEST(PercentileDigestTest, MergeExact)
+{
+  std::vector<float> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  PercentileDigest lhs, rhs;
+  for (size_t i = 0; i < input.size(); ++i)
+    (i < 3 ? lhs : rhs).add(input[i]);
+  lhs.merge(rhs);
+
+  EXPECT_FLOAT_NEAR(0.9, lhs.percentile(10));
+  EXPECT_FLOAT_NEAR(4.5, lhs.percentile(50));
+  EXPECT_FLOAT_NEAR(9, lhs.percentile(100));
+}
+
+TEST(PercentileDigestTest, Empty_NEG)
+{
+  PercentileDigest digest;
+
+  EXPECT_THROW(digest.percentile(50), std::runtime_error);
+  EXPECT_THROW(digest.percentile(101), std::runtime_error);
+}
+
+TEST(MovingAverageTest, SameAsVector)
+{
+  auto values = normalValues(100, 3);
+
+  for (uint32_t size : {1, 10, 16, 37, 100})
+  {
+    std::vector<float> input(values.begin(), values.begin() + size);
+    MovingAverage min_average(0.9, 16, true);
+    MovingAverage max_average(0.9, 16, false);
+    for (float value : input)
+    {
+      min_average.add(value);
+      max_average.add(value);
+    }
+
+    EXPECT_FLOAT_NEAR(getMovingAverage(input, 0.9, 16, true), min_average.value());
+    EXPECT_FLOAT_NEAR(getMovingAverage(input, 0.9, 16, false), max_average.value());
+  }
+}
+
+TEST(MovingAverageTest, Merge)
+{
+  auto values = normalValues(70, 4);
+
+  // Batches do not span the averages
+  std::vector<MovingAverage> averages(3, MovingAverage(0.9, 16, true));
+  for (size_t i = 0; i < values.size(); ++i)
+    averages[i < 32 ? 0 : (i < 48 ? 1 : 2)].add(values[i]);
+  for (size_t i = 1; i < averages.size(); ++i)
+    averages[0].merge(averages[i]);
+
+  EXPECT_FLOAT_NEAR(getMovingAverage(values, 0.9, 16, true), averages[0].value());
+}
+
+TEST(MovingAverageTest, PartialBatch_NEG)
+{
+  MovingAverage lhs(0.9, 16, true), rhs(0.9, 16, true);
+  lhs.add(1);
+  rhs.add(2);
+
+  EXPECT_THROW(lhs.merge(rhs), std::runtime_error);
+}
+
+TEST(MovingAverageTest, Empty_NEG)
+{
+  MovingAverage average(0.9, 16, true);
+
+  EXPECT_THROW(average.value(), std::runtime_error);
+}
+
+} // namespace record_minmax
@@ -21,6 +21,8 @@
 //#if defined(CKER_OPTIMIZED_EIGEN)
 
 #include <Eigen/Core>
+#include <cassert>
+#include <functional>
 #include <thread>
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
@@ -82,6 +84,26 @@ private:
   std::unique_ptr<Eigen::ThreadPool> pool_;
 };
 
+// Thread environment which runs an initializer on each worker thread before it takes any task,
+// e.g. to bind the thread to some CPUs
+struct InitThreadEnvironment : public Eigen::StlThreadEnvironment
+{
+  explicit InitThreadEnvironment(std::function<void()> init = nullptr) : init_(std::move(init)) {}
+
+  EnvThread *CreateThread(std::function<void()> f)
+  {
+    auto init = init_;
+    return new EnvThread([init, f]() {
+      if (init)
+        init();
+      f();
+    });
+  }
+
+private:
+  std::function<void()> init_;
+};
+
 struct EigenContext
 {
   constexpr static int default_num_threadpool_threads = 4;
@@ -100,15 +122,52 @@ struct EigenContext
     device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
   }
 
+  // Context with its own pool, which runs thread_init on each worker thread
+  EigenContext(int num_threads, std::function<void()> thread_init)
+  {
+    assert(num_threads > 0);
+    thread_pool_wrapper.reset(new Eigen::ThreadPoolTempl<InitThreadEnvironment>(
+      num_threads, InitThreadEnvironment(std::move(thread_init))));
+    device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
+  }
+
   static inline EigenContext &GetEigenContext()
   {
     static EigenContext instance;
     return instance;
   }
+
+  // Context used by kernels running on the calling thread instead of the global one
+  static inline EigenContext *&CurrentEigenContext()
+  {
+    static thread_local EigenContext *current = nullptr;
+    return current;
+  }
+};
+
+// Makes kernels on the calling thread use the given context while the object lives
+class ScopedEigenContext
+{
+public:
+  explicit ScopedEigenContext(EigenContext *ctx) : prev_(EigenContext::CurrentEigenContext())
+  {
+    EigenContext::CurrentEigenContext() = ctx;
+  }
+  ~ScopedEigenContext() { EigenContext::CurrentEigenContext() = prev_; }
+
+  ScopedEigenContext(const ScopedEigenContext &) = delete;
+  ScopedEigenContext &operator=(const ScopedEigenContext &) = delete;
+
+private:
+  EigenContext *prev_;
 };
 
 inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
 {
+  auto current = EigenContext::CurrentEigenContext();
+  if (current != nullptr)
+    return current->device.get();
+
   auto &ctx = EigenContext::GetEigenContext();
   return ctx.device.get();
 }
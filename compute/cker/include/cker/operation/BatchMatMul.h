@@ -24,6 +24,7 @@
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/operation/reference/BatchMatMul.h"
+#include "cker/operation/optimized/BatchMatMul.h"
 
 #include <vector>
 
@@ -106,6 +107,17 @@ public:
                            output_data);
   }
 
+  /**
+   * @brief   Run BatchMatMul by ruy GEMM for each batch, which does not need prepare()
+   */
+  void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                  const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                  float *output_data, ruy::Context *ruy_context)
+  {
+    optimized::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, adj_x, adj_y, output_shape,
+                           output_data, ruy_context);
+  }
+
 private:
   Shape swapRowColDims(const Shape &shape)
   {
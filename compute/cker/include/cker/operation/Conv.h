@@ -55,7 +55,11 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+    : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false),
+      _im2col_data(), _im2col_buffer(nullptr), _im2col_buffer_size(0)
+  {
+  }
 
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights, uint32_t dilationWidthFactor,
@@ -121,21 +125,25 @@ public:
                        params.dilation_height_factor);
     }
 
-    int im2col_size = _need_im2col ? _im2col_shape.FlatSize() : 1;
-
-    // Use heap if size is larger than 8MB
-    if (im2col_size > 8 * 1024 * 1024)
-    {
-      std::unique_ptr<uint8_t[]> im2col_data = std::make_unique<uint8_t[]>(im2col_size);
-      optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data, _im2col_shape, im2col_data.get());
-    }
-    else
+    uint8_t *im2col_data = nullptr;
+    if (_need_im2col)
     {
-      uint8_t im2col_data[im2col_size];
-      optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data, _im2col_shape, im2col_data);
+      const size_t im2col_size = _im2col_shape.FlatSize();
+      if (_im2col_buffer != nullptr && _im2col_buffer_size >= im2col_size)
+      {
+        im2col_data = _im2col_buffer;
+      }
+      else
+      {
+        // Grows only when shapes get larger, so steady-state runs do not allocate
+        if (_im2col_data.size() < im2col_size)
+          _im2col_data.resize(im2col_size);
+        im2col_data = _im2col_data.data();
+      }
     }
+
+    optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                    bias_data, output_shape, output_data, _im2col_shape, im2col_data);
   }
 
   void operator()(const ConvParams &params, const Shape &input_shape, const int8_t *input_data,
@@ -149,6 +157,34 @@ public:
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
+  /**
+   * @brief   Get the size of im2col buffer in bytes which the uint8 kernel needs
+   * @return  0 if the kernel can run without im2col buffer
+   */
+  static size_t im2colBufferSize(const Shape &input_shape, const Shape &kernel_shape,
+                                 const Shape &output_shape, uint32_t stride_width,
+                                 uint32_t stride_height, uint32_t dilation_width_factor,
+                                 uint32_t dilation_height_factor)
+  {
+    if (!isIm2colRequired(kernel_shape, stride_width, stride_height, dilation_width_factor,
+                          dilation_height_factor))
+      return 0;
+
+    return static_cast<size_t>(output_shape.Dims(0)) * output_shape.Dims(1) *
+           output_shape.Dims(2) * input_shape.Dims(3) * kernel_shape.Dims(1) * kernel_shape.Dims(2);
+  }
+
+  /**
+   * @brief   Set external im2col buffer used by the uint8 kernel instead of its own buffer
+   * @param[in] buffer  Buffer which is valid while the kernel runs
+   * @param[in] size    Size of buffer in bytes
+   */
+  void setIm2colBuffer(uint8_t *buffer, size_t size)
+  {
+    _im2col_buffer = buffer;
+    _im2col_buffer_size = size;
+  }
+
 private:
   bool usableMultiThreaded(PaddingType padding_type, uint32_t dilation_width_factor,
                            int32_t dilation_height_factor)
@@ -167,15 +203,23 @@ private:
     is_replaced_weights = true;
   }
 
-  void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
-                        const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
-                        uint32_t dilation_width_factor, uint32_t dilation_height_factor)
+  static bool isIm2colRequired(const Shape &kernel_shape, uint32_t stride_width,
+                               uint32_t stride_height, uint32_t dilation_width_factor,
+                               uint32_t dilation_height_factor)
   {
     const bool need_dilated_im2col = dilation_width_factor != 1 || dilation_height_factor != 1;
     const bool need_non_dilated_im2col = stride_width != 1 || stride_height != 1 ||
                                          kernel_shape.Dims(1) != 1 || kernel_shape.Dims(2) != 1;
 
-    _need_im2col = need_dilated_im2col || need_non_dilated_im2col;
+    return need_dilated_im2col || need_non_dilated_im2col;
+  }
+
+  void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
+                        const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
+                        uint32_t dilation_width_factor, uint32_t dilation_height_factor)
+  {
+    _need_im2col = isIm2colRequired(kernel_shape, stride_width, stride_height,
+                                    dilation_width_factor, dilation_height_factor);
 
     if (_need_im2col)
     {
@@ -191,6 +235,10 @@ private:
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  // Own im2col buffer used when no external buffer is given
+  std::vector<uint8_t> _im2col_data;
+  uint8_t *_im2col_buffer;
+  size_t _im2col_buffer_size;
   // Per channel output multiplier and shift.
   std::vector<int32_t> _per_channel_output_multiplier;
   std::vector<int> _per_channel_output_shift;
@@ -35,27 +35,69 @@ namespace cker
 class FCTempArena
 {
 public:
-  FCTempArena(void) : prepared(false), input_quantized(), scaling_factors(), accum_scratch()
+  FCTempArena(void)
+    : prepared(false), input_quantized(nullptr), scaling_factors(nullptr), accum_scratch(nullptr),
+      _storage()
   {
     // DO NOTHING
   }
 
-  void prepare(const Shape &input_shape, const Shape &weights_shape)
+  /**
+   * @brief   Get the size of buffer in bytes that holds all temporaries of hybrid kernel
+   */
+  static size_t bufferSize(const Shape &input_shape, const Shape &weights_shape,
+                           const Shape &output_shape)
   {
+    size_t input_quantized_size, scaling_factors_size;
+    layout(input_shape, weights_shape, input_quantized_size, scaling_factors_size);
+    return input_quantized_size + scaling_factors_size +
+           static_cast<size_t>(output_shape.FlatSize()) * sizeof(int32_t);
+  }
+
+  /**
+   * @brief   Place temporaries on the buffer
+   * @param[in] buffer  Buffer whose size is at least bufferSize(), or nullptr to use own storage
+   */
+  void prepare(const Shape &input_shape, const Shape &weights_shape, const Shape &output_shape,
+               uint8_t *buffer = nullptr)
+  {
+    if (buffer == nullptr)
+    {
+      _storage.resize(bufferSize(input_shape, weights_shape, output_shape));
+      buffer = _storage.data();
+    }
+
+    size_t input_quantized_size, scaling_factors_size;
+    layout(input_shape, weights_shape, input_quantized_size, scaling_factors_size);
+    input_quantized = reinterpret_cast<int8_t *>(buffer);
+    scaling_factors = reinterpret_cast<float *>(buffer + input_quantized_size);
+    accum_scratch =
+      reinterpret_cast<int32_t *>(buffer + input_quantized_size + scaling_factors_size);
+    prepared = true;
+  }
+
+private:
+  static void layout(const Shape &input_shape, const Shape &weights_shape,
+                     size_t &input_quantized_size, size_t &scaling_factors_size)
+  {
+    // Keep each region aligned for its element type
+    constexpr size_t kAlign = 16;
     auto input_size = input_shape.FlatSize();
-    input_quantized.resize(input_size);
 
     assert(weights_shape.DimensionsCount() == 2);
     int batch_size = input_size / weights_shape.Dims(1);
-    scaling_factors.resize(batch_size);
-    prepared = true;
+    input_quantized_size = (input_size + kAlign - 1) / kAlign * kAlign;
+    scaling_factors_size = (batch_size * sizeof(float) + kAlign - 1) / kAlign * kAlign;
   }
 
 public:
   bool prepared;
-  std::vector<int8_t> input_quantized;
-  std::vector<float> scaling_factors;
-  std::vector<int32_t> accum_scratch;
+  int8_t *input_quantized;
+  float *scaling_factors;
+  int32_t *accum_scratch;
+
+private:
+  std::vector<uint8_t> _storage;
 };
 
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
@@ -173,8 +215,8 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
 
   // Quantize input from float to uint8 + quantization params (scaling factor).
   float unused_min, unused_max;
-  float *scaling_factors_ptr = temp_arena.scaling_factors.data();
-  int8_t *quant_data = temp_arena.input_quantized.data();
+  float *scaling_factors_ptr = temp_arena.scaling_factors;
+  int8_t *quant_data = temp_arena.input_quantized;
 
   // Quantize each batch independently.
   for (int b = 0; b < batch_size; ++b)
@@ -188,9 +230,7 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
 
 // Compute output += weight * quantized_input
 #ifdef USE_RUY_GEMV
-  auto output_size = output_shape.FlatSize();
-  temp_arena.accum_scratch.resize(output_size);
-  int32_t *scratch = temp_arena.accum_scratch.data();
+  int32_t *scratch = temp_arena.accum_scratch;
   MatrixBatchVectorMultiplyAccumulate(filter_data, num_units, input_size, quant_data,
                                       scaling_factors_ptr, batch_size, scratch, output_data,
                                       /*result_stride=*/1, ruy_context);
@@ -199,8 +239,8 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
                                       scaling_factors_ptr, batch_size, output_data,
                                       /*result_stride=*/1);
   UNUSED_RELEASE(ruy_context);
-  UNUSED_RELEASE(output_shape);
 #endif
+  UNUSED_RELEASE(output_shape);
 
   // Apply activation function to floats.
   if (params.activation != FusedActivationFunctionType::kNone)
@@ -21,6 +21,9 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/TransposeConv.h"
+
+#include <vector>
 
 namespace nnfw
 {
@@ -105,6 +108,81 @@ inline void TransposeConv(const TransposeConvParams &params, const Shape &input_
   }
 }
 
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const uint8_t *input_data, const Shape &filter_shape,
+                          const uint8_t *filter_data, const Shape &output_shape,
+                          uint8_t *output_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  // Same "scatter" access pattern as float, but accumulated in int32
+  const int num_elements = output_shape.FlatSize();
+  std::vector<int32_t> scratch_buffer(num_elements, 0);
+
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    for (int in_y = 0; in_y < input_height; ++in_y)
+    {
+      for (int in_x = 0; in_x < input_width; ++in_x)
+      {
+        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+        {
+          const int out_x_origin = (in_x * stride_width) - pad_width;
+          const int out_y_origin = (in_y * stride_height) - pad_height;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+              {
+                const int out_x = out_x_origin + filter_x;
+                const int out_y = out_y_origin + filter_y;
+                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
+                    (out_y < output_height))
+                {
+                  int32_t input_value =
+                    input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
+                  int32_t filter_value =
+                    filter_data[Offset(filter_shape, out_channel, filter_y, filter_x, in_channel)];
+                  scratch_buffer[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
+                    (input_value + params.input_offset) * (filter_value + params.weights_offset);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < num_elements; ++i)
+  {
+    int32_t acc = MultiplyByQuantizedMultiplier(scratch_buffer[i], params.output_multiplier,
+                                                params.output_shift);
+    acc += params.output_offset;
+    acc = std::max(acc, params.quantized_activation_min);
+    acc = std::min(acc, params.quantized_activation_max);
+    output_data[i] = static_cast<uint8_t>(acc);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
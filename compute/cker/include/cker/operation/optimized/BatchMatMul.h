@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+#define __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/CpuBackendThreadpool.h"
+
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Batch dimensions of BatchMatMul operands, broadcasted as in reference::BatchMatMul
+// Operands are extended to rank 5, so that there are always 3 batch dimensions.
+struct BatchMatMulBatches
+{
+  BatchMatMulBatches(const Shape &lhs_shape, const Shape &rhs_shape)
+  {
+    const Shape extended_lhs_shape = Shape::ExtendedShape(5, lhs_shape);
+    const Shape extended_rhs_shape = Shape::ExtendedShape(5, rhs_shape);
+    const int lhs_matrix_size = extended_lhs_shape.Dims(3) * extended_lhs_shape.Dims(4);
+    const int rhs_matrix_size = extended_rhs_shape.Dims(3) * extended_rhs_shape.Dims(4);
+
+    // Strides of broadcasted dimension is 0, so that the same matrix is used again
+    int lhs_stride = lhs_matrix_size;
+    int rhs_stride = rhs_matrix_size;
+    for (int i = 2; i >= 0; --i)
+    {
+      const int lhs_dim = extended_lhs_shape.Dims(i);
+      const int rhs_dim = extended_rhs_shape.Dims(i);
+      assert(lhs_dim == rhs_dim || lhs_dim == 1 || rhs_dim == 1);
+      dims[i] = std::max(lhs_dim, rhs_dim);
+      lhs_strides[i] = (lhs_dim == 1) ? 0 : lhs_stride;
+      rhs_strides[i] = (rhs_dim == 1) ? 0 : rhs_stride;
+      lhs_stride *= lhs_dim;
+      rhs_stride *= rhs_dim;
+    }
+  }
+
+  int count() const { return dims[0] * dims[1] * dims[2]; }
+
+  // Offsets of lhs and rhs matrix of flattened batch index b
+  int lhsOffset(int b) const
+  {
+    return (b / (dims[1] * dims[2])) * lhs_strides[0] + ((b / dims[2]) % dims[1]) * lhs_strides[1] +
+           (b % dims[2]) * lhs_strides[2];
+  }
+  int rhsOffset(int b) const
+  {
+    return (b / (dims[1] * dims[2])) * rhs_strides[0] + ((b / dims[2]) % dims[1]) * rhs_strides[1] +
+           (b % dims[2]) * rhs_strides[2];
+  }
+
+  int dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+};
+
+// Single matrix multiplication of BatchMatMul
+//
+// lhs is M x K (K x M if adj_x) and rhs is K x N (N x K if adj_y), in row-major order. Transposes
+// are folded into the storage order of ruy matrices instead of copying operands.
+//
+// ruy is much faster with column-major destination, so the transposed product is computed, i.e.
+// N x M column-major dst = (rhs^T) * (lhs^T).
+struct BatchMatMulGemm
+{
+  BatchMatMulGemm(int lhs_rows, int lhs_cols, int rhs_rows, int rhs_cols, bool adj_x, bool adj_y)
+  {
+    const int m = adj_x ? lhs_cols : lhs_rows;
+    const int k = adj_x ? lhs_rows : lhs_cols;
+    const int n = adj_y ? rhs_rows : rhs_cols;
+    assert(k == (adj_y ? rhs_cols : rhs_rows));
+
+    ruy::MakeSimpleLayout(n, k, adj_y ? ruy::Order::kRowMajor : ruy::Order::kColMajor,
+                          &rhs_t_layout);
+    ruy::MakeSimpleLayout(k, m, adj_x ? ruy::Order::kRowMajor : ruy::Order::kColMajor,
+                          &lhs_t_layout);
+    ruy::MakeSimpleLayout(n, m, ruy::Order::kColMajor, &dst_t_layout);
+  }
+
+  int numMuls() const { return rhs_t_layout.rows() * rhs_t_layout.cols() * lhs_t_layout.cols(); }
+  int dstSize() const { return dst_t_layout.rows() * dst_t_layout.cols(); }
+
+  void run(const float *lhs_data, const float *rhs_data, float *dst_data,
+           ruy::Context *ruy_context) const
+  {
+    ruy::Matrix<float> ruy_lhs;
+    ruy::Matrix<float> ruy_rhs;
+    ruy::Matrix<float> ruy_dst;
+    *ruy_lhs.mutable_layout() = rhs_t_layout;
+    *ruy_rhs.mutable_layout() = lhs_t_layout;
+    *ruy_dst.mutable_layout() = dst_t_layout;
+    ruy_lhs.set_data(rhs_data);
+    ruy_rhs.set_data(lhs_data);
+    ruy_dst.set_data(dst_data);
+
+    ruy::MulParams<float, float> ruy_mul_params;
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+  }
+
+  ruy::Layout rhs_t_layout;
+  ruy::Layout lhs_t_layout;
+  ruy::Layout dst_t_layout;
+};
+
+// ruy::Context for GEMMs run inside a worker of BatchMatMul, which must not spawn more threads
+inline ruy::Context *GetBatchMatMulWorkerRuyContext()
+{
+  static thread_local ruy::Context context;
+  context.set_max_num_threads(1);
+  return &context;
+}
+
+// BatchMatMul can run with multi threads on the batch dimension.
+// Each thread processes output matrices of flattened batch index in [batch_start, batch_end).
+struct BatchMatMulWorkerTask : cpu_backend_threadpool::Task
+{
+  BatchMatMulWorkerTask(const BatchMatMulBatches &batches, const BatchMatMulGemm &gemm,
+                        const float *lhs_data, const float *rhs_data, float *output_data,
+                        int batch_start, int batch_end)
+    : batches_(batches), gemm_(gemm), lhs_data_(lhs_data), rhs_data_(rhs_data),
+      output_data_(output_data), batch_start_(batch_start), batch_end_(batch_end)
+  {
+  }
+
+  void Run() override
+  {
+    ruy::Context *ruy_context = GetBatchMatMulWorkerRuyContext();
+    const int dst_size = gemm_.dstSize();
+    for (int b = batch_start_; b < batch_end_; ++b)
+    {
+      gemm_.run(lhs_data_ + batches_.lhsOffset(b), rhs_data_ + batches_.rhsOffset(b),
+                output_data_ + b * dst_size, ruy_context);
+    }
+  }
+
+private:
+  const BatchMatMulBatches &batches_;
+  const BatchMatMulGemm &gemm_;
+  const float *lhs_data_;
+  const float *rhs_data_;
+  float *output_data_;
+  int batch_start_;
+  int batch_end_;
+};
+
+inline int HowManyBatchMatMulThreads(int batch_count, int muls_per_batch, int max_threads)
+{
+  // How many scalar multiplications are needed to make it worth using one more thread
+  static constexpr int64_t kMinMulPerThread = 1 << 13; // 8k
+  const int64_t num_muls = static_cast<int64_t>(batch_count) * muls_per_batch;
+  const int64_t thread_count = std::max<int64_t>(1, num_muls / kMinMulPerThread);
+  return static_cast<int>(std::min<int64_t>(thread_count, max_threads));
+}
+
+inline bool MultithreadAlongBatchMatMulBatches(int thread_count, int batch_count)
+{
+  assert(thread_count >= 2);
+  // With fewer batches than threads, ruy splitting each GEMM keeps all threads busy
+  if (batch_count < thread_count)
+  {
+    return false;
+  }
+  // Otherwise batches are balanced enough among threads if each thread gets at least 2 batches
+  // or the same number of batches
+  return (batch_count >= 2 * thread_count) || (batch_count % thread_count == 0);
+}
+
+inline void BatchMatMul(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                        const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                        float *output_data, ruy::Context *ruy_context)
+{
+  assert(ruy_context != nullptr);
+  const int lhs_rank = lhs_shape.DimensionsCount();
+  const int rhs_rank = rhs_shape.DimensionsCount();
+  assert(lhs_rank >= 2 && lhs_rank <= 5);
+  assert(rhs_rank >= 2 && rhs_rank <= 5);
+  UNUSED_RELEASE(output_shape);
+
+  const BatchMatMulBatches batches{lhs_shape, rhs_shape};
+  const BatchMatMulGemm gemm{lhs_shape.Dims(lhs_rank - 2), lhs_shape.Dims(lhs_rank - 1),
+                             rhs_shape.Dims(rhs_rank - 2), rhs_shape.Dims(rhs_rank - 1), adj_x,
+                             adj_y};
+  const int batch_count = batches.count();
+  assert(output_shape.FlatSize() == batch_count * gemm.dstSize());
+
+  const int thread_count =
+    HowManyBatchMatMulThreads(batch_count, gemm.numMuls(), ruy_context->max_num_threads());
+
+  if (thread_count < 2 || !MultithreadAlongBatchMatMulBatches(thread_count, batch_count))
+  {
+    for (int b = 0; b < batch_count; ++b)
+    {
+      gemm.run(lhs_data + batches.lhsOffset(b), rhs_data + batches.rhsOffset(b),
+               output_data + b * gemm.dstSize(), ruy_context);
+    }
+    return;
+  }
+
+  std::vector<BatchMatMulWorkerTask> tasks;
+  tasks.reserve(thread_count);
+  int batch_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int batch_end = batch_start + (batch_count - batch_start) / (thread_count - i);
+    tasks.emplace_back(batches, gemm, lhs_data, rhs_data, output_data, batch_start, batch_end);
+    batch_start = batch_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
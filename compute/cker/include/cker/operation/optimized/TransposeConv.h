@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// TransposeConv is computed as a GEMM followed by col2im.
+//
+// The GEMM multiplies the filter in [filter_height, filter_width, output_depth, input_depth]
+// (HWOI) order with the input, so that col2im data has, for each input pixel, the contributions
+// to all output pixels it influences. col2im then gathers them into each output row, which lets
+// output rows be computed independently by multiple threads.
+
+/**
+ * @brief   Get the number of col2im elements for a batch
+ */
+inline size_t TransposeConvCol2imSize(const Shape &input_shape, const Shape &filter_shape)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  return static_cast<size_t>(input_shape.Dims(1)) * input_shape.Dims(2) * filter_shape.Dims(0) *
+         filter_shape.Dims(1) * filter_shape.Dims(2);
+}
+
+/**
+ * @brief   Reorder filter of [output_depth, filter_height, filter_width, input_depth] into
+ *          [filter_height, filter_width, output_depth, input_depth]
+ */
+template <typename T>
+inline void TransposeConvFilterToHWOI(const Shape &filter_shape, const T *filter_data,
+                                      T *hwoi_filter_data)
+{
+  assert(filter_shape.DimensionsCount() == 4);
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+
+  for (int ky = 0; ky < filter_height; ++ky)
+  {
+    for (int kx = 0; kx < filter_width; ++kx)
+    {
+      for (int oc = 0; oc < output_depth; ++oc)
+      {
+        const T *src = filter_data + Offset(filter_shape, oc, ky, kx, 0);
+        std::copy(src, src + input_depth, hwoi_filter_data);
+        hwoi_filter_data += input_depth;
+      }
+    }
+  }
+}
+
+// col2im[(filter_height * filter_width * output_depth) x (input_height * input_width)] =
+//   hwoi_filter[(filter_height * filter_width * output_depth) x input_depth] *
+//   input[input_depth x (input_height * input_width)], all in column-major order
+inline void TransposeConvGemm(const TransposeConvParams &, int rows, int depth, int cols,
+                              const float *hwoi_filter_data, bool is_filter_constant,
+                              const float *input_data, float *col2im_data,
+                              ruy::Context *ruy_context)
+{
+  ruy::Matrix<float> ruy_lhs;
+  ruy::Matrix<float> ruy_rhs;
+  ruy::Matrix<float> ruy_dst;
+  ruy::MakeSimpleLayout(rows, depth, ruy::Order::kRowMajor, ruy_lhs.mutable_layout());
+  ruy::MakeSimpleLayout(depth, cols, ruy::Order::kColMajor, ruy_rhs.mutable_layout());
+  ruy::MakeSimpleLayout(rows, cols, ruy::Order::kColMajor, ruy_dst.mutable_layout());
+  ruy_lhs.set_data(hwoi_filter_data);
+  ruy_rhs.set_data(input_data);
+  ruy_dst.set_data(col2im_data);
+  if (is_filter_constant)
+    ruy_lhs.set_cache_policy(ruy::CachePolicy::kCacheIfLargeSpeedup);
+
+  ruy::MulParams<float, float> ruy_mul_params;
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+inline void TransposeConvGemm(const TransposeConvParams &params, int rows, int depth, int cols,
+                              const uint8_t *hwoi_filter_data, bool is_filter_constant,
+                              const uint8_t *input_data, int32_t *col2im_data,
+                              ruy::Context *ruy_context)
+{
+  ruy::Matrix<uint8_t> ruy_lhs;
+  ruy::Matrix<uint8_t> ruy_rhs;
+  ruy::Matrix<int32_t> ruy_dst;
+  ruy::MakeSimpleLayout(rows, depth, ruy::Order::kRowMajor, ruy_lhs.mutable_layout());
+  ruy::MakeSimpleLayout(depth, cols, ruy::Order::kColMajor, ruy_rhs.mutable_layout());
+  ruy::MakeSimpleLayout(rows, cols, ruy::Order::kColMajor, ruy_dst.mutable_layout());
+  ruy_lhs.set_data(hwoi_filter_data);
+  ruy_lhs.set_zero_point(static_cast<uint8_t>(-params.weights_offset));
+  ruy_rhs.set_data(input_data);
+  ruy_rhs.set_zero_point(static_cast<uint8_t>(-params.input_offset));
+  ruy_dst.set_data(col2im_data);
+  if (is_filter_constant)
+    ruy_lhs.set_cache_policy(ruy::CachePolicy::kCacheIfLargeSpeedup);
+
+  ruy::MulParams<int32_t, int32_t> ruy_mul_params;
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+inline void TransposeConvStore(const TransposeConvParams &params, const float *acc_data, int size,
+                               float *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = ActivationFunctionWithMinMax(acc_data[i], params.float_activation_min,
+                                                  params.float_activation_max);
+  }
+}
+
+inline void TransposeConvStore(const TransposeConvParams &params, const int32_t *acc_data,
+                               int size, uint8_t *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    int32_t acc = MultiplyByQuantizedMultiplier(acc_data[i], params.output_multiplier,
+                                                params.output_shift);
+    acc += params.output_offset;
+    acc = std::max(acc, params.quantized_activation_min);
+    acc = std::min(acc, params.quantized_activation_max);
+    output_data[i] = static_cast<uint8_t>(acc);
+  }
+}
+
+// Each thread gathers col2im data of a batch into output rows in [row_start, row_end).
+template <typename T, typename AccT> struct TransposeConvCol2imTask : cpu_backend_threadpool::Task
+{
+  TransposeConvCol2imTask(const TransposeConvParams &params, const Shape &input_shape,
+                          const Shape &filter_shape, const Shape &output_shape,
+                          const AccT *col2im_data, T *output_data, int row_start, int row_end)
+    : params_(params), input_shape_(input_shape), filter_shape_(filter_shape),
+      output_shape_(output_shape), col2im_data_(col2im_data), output_data_(output_data),
+      row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    const int stride_width = params_.stride_width;
+    const int stride_height = params_.stride_height;
+    const int pad_width = params_.padding_values.width;
+    const int pad_height = params_.padding_values.height;
+    const int input_height = input_shape_.Dims(1);
+    const int input_width = input_shape_.Dims(2);
+    const int filter_height = filter_shape_.Dims(1);
+    const int filter_width = filter_shape_.Dims(2);
+    const int output_width = output_shape_.Dims(2);
+    const int output_depth = output_shape_.Dims(3);
+    const int row_size = output_width * output_depth;
+    const int pixel_size = filter_height * filter_width * output_depth;
+
+    std::vector<AccT> acc(row_size);
+    for (int out_y = row_start_; out_y < row_end_; ++out_y)
+    {
+      std::fill(acc.begin(), acc.end(), AccT{0});
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        // Find the input row which influences this output row with this filter row
+        const int in_y_scaled = out_y + pad_height - filter_y;
+        if (in_y_scaled < 0 || in_y_scaled % stride_height != 0)
+          continue;
+        const int in_y = in_y_scaled / stride_height;
+        if (in_y >= input_height)
+          continue;
+
+        for (int in_x = 0; in_x < input_width; ++in_x)
+        {
+          const AccT *pixel_data = col2im_data_ + (in_y * input_width + in_x) * pixel_size +
+                                   filter_y * filter_width * output_depth;
+          const int out_x_origin = in_x * stride_width - pad_width;
+          const int filter_x_start = std::max(0, -out_x_origin);
+          const int filter_x_end = std::min(filter_width, output_width - out_x_origin);
+          for (int filter_x = filter_x_start; filter_x < filter_x_end; ++filter_x)
+          {
+            const AccT *src = pixel_data + filter_x * output_depth;
+            AccT *dst = acc.data() + (out_x_origin + filter_x) * output_depth;
+            for (int c = 0; c < output_depth; ++c)
+              dst[c] += src[c];
+          }
+        }
+      }
+      TransposeConvStore(params_, acc.data(), row_size, output_data_ + out_y * row_size);
+    }
+  }
+
+private:
+  const TransposeConvParams &params_;
+  const Shape &input_shape_;
+  const Shape &filter_shape_;
+  const Shape &output_shape_;
+  const AccT *col2im_data_;
+  T *output_data_;
+  int row_start_;
+  int row_end_;
+};
+
+inline int HowManyTransposeConvThreads(const Shape &output_shape, int max_threads)
+{
+  // How many accumulated elements are needed to make it worth using one more thread
+  static constexpr int kMinAccPerThread = 1 << 13; // 8k
+  const int output_height = output_shape.Dims(1);
+  const int row_acc = output_shape.Dims(2) * output_shape.Dims(3);
+  const int thread_count = std::max(1, output_height * row_acc / kMinAccPerThread);
+  return std::min({thread_count, output_height, max_threads});
+}
+
+/**
+ * @brief   TransposeConv by GEMM and col2im
+ * @param[in] hwoi_filter_data  Filter reordered by TransposeConvFilterToHWOI()
+ * @param[in] col2im_data       Buffer of TransposeConvCol2imSize() elements
+ */
+template <typename T, typename AccT>
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const T *input_data, const Shape &filter_shape,
+                          const T *hwoi_filter_data, bool is_filter_constant,
+                          const Shape &output_shape, T *output_data, AccT *col2im_data,
+                          ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(ruy_context != nullptr);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_size = input_shape.Dims(1) * input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int gemm_rows = filter_shape.Dims(1) * filter_shape.Dims(2) * output_depth;
+
+  const int thread_count =
+    HowManyTransposeConvThreads(output_shape, ruy_context->max_num_threads());
+
+  const int input_batch_size = input_size * input_depth;
+  const int output_batch_size = output_height * output_shape.Dims(2) * output_depth;
+  for (int b = 0; b < batches; ++b)
+  {
+    T *output_batch_data = output_data + b * output_batch_size;
+    TransposeConvGemm(params, gemm_rows, input_depth, input_size, hwoi_filter_data,
+                      is_filter_constant, input_data + b * input_batch_size, col2im_data,
+                      ruy_context);
+
+    std::vector<TransposeConvCol2imTask<T, AccT>> tasks;
+    tasks.reserve(thread_count);
+    int row_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int row_end = row_start + (output_height - row_start) / (thread_count - i);
+      tasks.emplace_back(params, input_shape, filter_shape, output_shape, col2im_data,
+                         output_batch_data, row_start, row_end);
+      row_start = row_end;
+    }
+    if (thread_count == 1)
+      tasks[0].Run();
+    else
+      cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
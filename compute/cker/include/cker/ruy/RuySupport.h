@@ -19,9 +19,12 @@
 #define __NNFW_CKER_RUY_RUY_SUPPORT_H__
 
 #include <util/ConfigSource.h>
+#include <ruy/context.h>
 #include <ruy/matrix.h>
 #include <ruy/ruy.h>
+#include <ruy/thread_pool.h>
 #include <cassert>
+#include <vector>
 #include "cker/Types.h"
 
 namespace nnfw
@@ -81,6 +84,24 @@ void MakeRuyMulParams(const GemmParamsType &params, RuySpecType *ruy_mul_params)
   ruy_mul_params->set_clamp_max(params.clamp_max);
 }
 
+namespace detail
+{
+
+struct IdleTask final : public ruy::Task
+{
+  void Run() override {}
+};
+
+} // namespace detail
+
+// Creates the worker threads of the context now, so that they inherit the CPU affinity of the
+// calling thread. Otherwise ruy creates them later, on the thread which runs a kernel.
+inline void CreateWorkerThreads(ruy::Context *context)
+{
+  std::vector<detail::IdleTask> tasks(context->max_num_threads());
+  context->mutable_thread_pool()->Execute(static_cast<int>(tasks.size()), tasks.data());
+}
+
 } // namespace ruy_support
 } // namespace cker
 } // namespace nnfw
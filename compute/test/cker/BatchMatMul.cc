@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<float>(static_cast<int>(i * 7 % 13) - 6) / 8;
+  return data;
+}
+
+// Run BatchMatMul with both reference and ruy kernel, and compare their outputs
+void verify(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y,
+            const Shape &output_shape, int num_threads)
+{
+  const auto lhs = makeData(lhs_shape);
+  const auto rhs = makeData(rhs_shape);
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+
+  nnfw::cker::BatchMatMul reference_kernel;
+  reference_kernel.prepare(lhs_shape, rhs_shape, adj_x, adj_y);
+  reference_kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+                   expected.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+  nnfw::cker::BatchMatMul kernel;
+  kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape, actual.data(),
+         &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-4) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, BatchMatMul)
+{
+  // Simple 2D matrix multiplication
+  {
+    const Shape output_shape{3, 5};
+    verify(Shape{3, 4}, Shape{4, 5}, false, false, output_shape, 1);
+    verify(Shape{4, 3}, Shape{4, 5}, true, false, output_shape, 1);
+    verify(Shape{3, 4}, Shape{5, 4}, false, true, output_shape, 1);
+    verify(Shape{4, 3}, Shape{5, 4}, true, true, output_shape, 1);
+  }
+
+  // Batched, with and without broadcasting
+  {
+    verify(Shape{2, 3, 7, 9}, Shape{2, 3, 9, 5}, false, false, Shape{2, 3, 7, 5}, 1);
+    verify(Shape{2, 3, 7, 9}, Shape{9, 5}, false, false, Shape{2, 3, 7, 5}, 1);
+    verify(Shape{1, 3, 9, 7}, Shape{2, 1, 5, 9}, true, true, Shape{2, 3, 7, 5}, 1);
+  }
+
+  // Multithreaded along batches, and inside a big single GEMM
+  {
+    verify(Shape{16, 32, 64}, Shape{16, 64, 32}, false, false, Shape{16, 32, 32}, 4);
+    verify(Shape{4, 2, 64, 32}, Shape{1, 2, 32, 64}, true, true, Shape{4, 2, 32, 32}, 4);
+    verify(Shape{3, 64, 128}, Shape{128, 64}, false, false, Shape{3, 64, 64}, 4);
+    verify(Shape{1, 128, 256}, Shape{1, 128, 256}, false, true, Shape{1, 128, 128}, 4);
+  }
+}
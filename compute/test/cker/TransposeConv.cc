@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeConvParams;
+
+struct TestCase
+{
+  Shape input_shape;
+  Shape filter_shape;
+  Shape output_shape;
+  int stride;
+  int pad;
+};
+
+TransposeConvParams makeParams(const TestCase &tc)
+{
+  TransposeConvParams params;
+  params.stride_width = tc.stride;
+  params.stride_height = tc.stride;
+  params.padding_values.width = tc.pad;
+  params.padding_values.height = tc.pad;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  // Scale of output is 4 times of input * filter
+  params.input_offset = -120;
+  params.weights_offset = -130;
+  params.output_offset = 128;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -1;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+  return params;
+}
+
+template <typename T, typename AccT> void verify(const TestCase &tc, int num_threads)
+{
+  const auto params = makeParams(tc);
+
+  std::vector<T> input(tc.input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>(std::is_floating_point<T>::value ? (i % 11) * 0.25f - 1.f
+                                                               : 110 + i % 21);
+  std::vector<T> filter(tc.filter_shape.FlatSize());
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = static_cast<T>(std::is_floating_point<T>::value ? (i % 7) * 0.5f - 1.5f
+                                                                : 125 + i % 11);
+
+  std::vector<T> expected(tc.output_shape.FlatSize());
+  nnfw::cker::TransposeConv(params, tc.input_shape, input.data(), tc.filter_shape, filter.data(),
+                            tc.output_shape, expected.data());
+
+  std::vector<T> hwoi_filter(filter.size());
+  nnfw::cker::optimized::TransposeConvFilterToHWOI(tc.filter_shape, filter.data(),
+                                                   hwoi_filter.data());
+  std::vector<AccT> col2im(
+    nnfw::cker::optimized::TransposeConvCol2imSize(tc.input_shape, tc.filter_shape));
+  std::vector<T> actual(tc.output_shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+  nnfw::cker::optimized::TransposeConv(params, tc.input_shape, input.data(), tc.filter_shape,
+                                       hwoi_filter.data(), true, tc.output_shape, actual.data(),
+                                       col2im.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-4) << "at " << i;
+}
+
+const std::vector<TestCase> test_cases = {
+  // stride 1, SAME
+  {Shape{1, 4, 4, 2}, Shape{3, 3, 3, 2}, Shape{1, 4, 4, 3}, 1, 1},
+  // stride 2, VALID
+  {Shape{2, 3, 5, 2}, Shape{3, 3, 3, 2}, Shape{2, 7, 11, 3}, 2, 0},
+  // stride 2, SAME with even filter
+  {Shape{1, 5, 5, 4}, Shape{2, 4, 4, 4}, Shape{1, 10, 10, 2}, 2, 1},
+  // Big enough to be multithreaded
+  {Shape{1, 16, 16, 8}, Shape{16, 3, 3, 8}, Shape{1, 32, 32, 16}, 2, 0},
+};
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConv)
+{
+  for (const auto &tc : test_cases)
+  {
+    verify<float, float>(tc, 1);
+    verify<float, float>(tc, 4);
+  }
+}
+
+TEST(CKer_Operation, TransposeConvQuant8)
+{
+  for (const auto &tc : test_cases)
+  {
+    verify<uint8_t, int32_t>(tc, 1);
+    verify<uint8_t, int32_t>(tc, 4);
+  }
+}
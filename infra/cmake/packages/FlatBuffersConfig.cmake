@@ -68,9 +68,10 @@ if(FlatBuffers_FOUND)
   endfunction(FlatBuffers_Generate)
 
   function(FlatBuffers_Target TGT)
+    set(options GEN_MUTABLE)
     set(oneValueArgs OUTPUT_DIR SCHEMA_DIR INCLUDE_DIR)
     set(multiValueArgs SCHEMA_FILES)
-    cmake_parse_arguments(ARG "" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+    cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
     # Use OUTPUT_DIR as INCLUDE_DIR if INCLUDE_DIR is not specified
     if(NOT ARG_INCLUDE_DIR)
@@ -96,12 +97,18 @@ if(FlatBuffers_FOUND)
       list(APPEND OUTPUT_FILES "${abs_output_dir}/${schema_fn_we}_generated.h")
     endforeach()
 
+    # Let's generate accessors to mutate serialized data in place if requested
+    unset(FLATC_EXTRA_ARGS)
+    if(ARG_GEN_MUTABLE)
+      list(APPEND FLATC_EXTRA_ARGS --gen-mutable)
+    endif(ARG_GEN_MUTABLE)
+
     # Generate headers
     add_custom_command(OUTPUT ${OUTPUT_FILES}
                        COMMAND ${CMAKE_COMMAND} -E make_directory "${abs_output_dir}"
                        COMMAND "$<TARGET_FILE:flatbuffers::flatc>" -c --no-includes
                                --no-union-value-namespacing
-                               --gen-object-api -o "${abs_output_dir}"
+                               --gen-object-api ${FLATC_EXTRA_ARGS} -o "${abs_output_dir}"
                                ${SCHEMA_FILES}
                        DEPENDS ${SCHEMA_FILES}
                        COMMENT "Generate '${TGT}' headers")
@@ -89,3 +89,5 @@ option(BUILD_FXDIV "Build fxdiv library from the source" ON)
 ## Default sample build configuration
 #
 option(BUILD_MINIMAL_SAMPLE "Build minimal app" OFF)
+option(BUILD_PIPELINE_SAMPLE "Build pipeline app" OFF)
+option(BUILD_BATCHING_SAMPLE "Build batching app" OFF)
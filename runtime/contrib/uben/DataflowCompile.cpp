@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Dataflow executor compile benchmark
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <ir/Graph.h>
+#include <ir/operation/BinaryArithmetic.h>
+#include <util/TracingCtx.h>
+
+#include <memory>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(NUM_OPS, 1000);
+
+namespace
+{
+
+using namespace onert::ir;
+
+// Model: a chain of elementwise add operations with a constant
+// result(0) <= input + one
+// result(n) <= result(n-1) + one
+std::shared_ptr<Graph> createAddChain(uint32_t num_ops)
+{
+  static float one_data[4] = {1, 1, 1, 1};
+
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+
+  auto one = graph->addOperand(shape, type);
+  graph->operands().at(one).data(
+    std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&one_data), 16));
+
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+
+  auto input = graph->addOperand(shape, type);
+  auto lhs = input;
+  for (uint32_t i = 0; i < num_ops; ++i)
+  {
+    auto result = graph->addOperand(shape, type);
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, one}, OperandIndexSequence{result}, param));
+    lhs = result;
+  }
+
+  graph->addInput(input);
+  graph->addOutput(lhs);
+  graph->verify();
+  return graph;
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("onert::compiler::Compiler(Dataflow)", [](nonius::chronometer meter) {
+  auto num_ops = meter.param<NUM_OPS>();
+
+  // Compilation consumes the model, so prepare one compiler for each run
+  std::vector<std::unique_ptr<onert::util::TracingCtx>> tracing_ctxs;
+  std::vector<std::unique_ptr<onert::compiler::Compiler>> compilers;
+  std::vector<std::shared_ptr<onert::exec::ExecutorMap>> executors(meter.runs());
+  for (int i = 0; i < meter.runs(); ++i)
+  {
+    auto subgs = std::make_shared<Subgraphs>();
+    subgs->push(SubgraphIndex{0}, createAddChain(num_ops));
+    tracing_ctxs.emplace_back(std::make_unique<onert::util::TracingCtx>(subgs.get()));
+    compilers.emplace_back(
+      std::make_unique<onert::compiler::Compiler>(subgs, tracing_ctxs.back().get()));
+    compilers.back()->options().executor = "Dataflow";
+  }
+
+  meter.measure([&](int i) {
+    // Run!
+    executors[i] = compilers[i]->compile();
+  });
+})
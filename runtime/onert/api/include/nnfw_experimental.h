@@ -96,4 +96,122 @@ NNFW_STATUS nnfw_input_tensorindex(nnfw_session *session, const char *tensorname
  */
 NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensorname, uint32_t *index);
 
+/**
+ * @brief Execution context of a prepared session
+ *
+ * An execution context owns its own compiled copy of the model of the session it is created from.
+ * Executions on different contexts of the same session can run concurrently.
+ */
+typedef struct nnfw_execution_context nnfw_execution_context;
+
+/**
+ * @brief Create an execution context from a prepared session
+ *
+ * The model is loaded and compiled again for the context with the options the session was
+ * prepared with. The session does not keep an uncompiled copy of the model, so constant data is
+ * read again from the model file, or refers to the buffer the model was loaded from.
+ *
+ * @note This function must not be called concurrently for the same session
+ *
+ * @param[in]  session the session object, which must be prepared
+ * @param[out] context the execution context to be created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session,
+                                          nnfw_execution_context **context);
+
+/**
+ * @brief Destroy an execution context
+ *
+ * @param[in] context the execution context to be destroyed
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_destroy_execution_context(nnfw_execution_context *context);
+
+/**
+ * @brief Set input buffer of an execution context
+ *
+ * @see nnfw_set_input
+ */
+NNFW_STATUS nnfw_set_input_with_context(nnfw_execution_context *context, uint32_t index,
+                                        NNFW_TYPE type, const void *buffer, size_t length);
+
+/**
+ * @brief Set output buffer of an execution context
+ *
+ * @see nnfw_set_output
+ */
+NNFW_STATUS nnfw_set_output_with_context(nnfw_execution_context *context, uint32_t index,
+                                         NNFW_TYPE type, void *buffer, size_t length);
+
+/**
+ * @brief Run inference on an execution context
+ *
+ * Contexts created from the same session can be run from different threads at the same time.
+ * A single context must not be run concurrently.
+ *
+ * @param[in] context the execution context to run
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_with_context(nnfw_execution_context *context);
+
+/**
+ * @brief Maximum length of names in @c nnfw_op_stats including the terminating null character
+ */
+#define NNFW_OP_STATS_MAX_NAME_LENGTH 64
+
+/**
+ * @brief Execution statistics of an operation or a whole subgraph
+ *
+ * Latencies are measured in nanoseconds, and percentiles are estimated from a histogram whose
+ * buckets are within 25% of each other.
+ */
+typedef struct
+{
+  /** Index of the subgraph */
+  uint32_t subgraph_index;
+  /** Index of the operation in the subgraph, or UINT32_MAX for the whole subgraph */
+  uint32_t op_index;
+  /** Name of the operation, or "Subgraph" for the whole subgraph */
+  char name[NNFW_OP_STATS_MAX_NAME_LENGTH];
+  /** Backend which the operation ran on, or empty for the whole subgraph */
+  char backend[NNFW_OP_STATS_MAX_NAME_LENGTH];
+  /** Number of invocations */
+  uint64_t count;
+  /** Bytes of static inputs and outputs touched by all invocations */
+  uint64_t bytes;
+  /** Sum of latencies */
+  uint64_t total_ns;
+  /** Median latency */
+  uint64_t p50_ns;
+  /** 99th percentile latency */
+  uint64_t p99_ns;
+  /** Maximum latency */
+  uint64_t max_ns;
+} nnfw_op_stats;
+
+/**
+ * @brief Get execution statistics of operations and subgraphs
+ *
+ * Statistics are gathered only if config "OP_STATS" is set to "1" before @c nnfw_prepare.
+ * They include runs of the session and all execution contexts created from it. This function can
+ * be called while they are running.
+ *
+ * @param[in]     session the session whose statistics are taken
+ * @param[out]    stats   array to be filled with statistics, or NULL to get the count only
+ * @param[in,out] count   in: the number of elements of @c stats,
+ *                        out: the number of available statistics
+ * @return        @c NNFW_STATUS_NO_ERROR if successful, @c NNFW_STATUS_INVALID_STATE if the
+ *                statistics are not gathered
+ */
+NNFW_STATUS nnfw_get_op_stats(nnfw_session *session, nnfw_op_stats *stats, uint32_t *count);
+
+/**
+ * @brief Clear execution statistics gathered so far
+ *
+ * @param[in] session the session whose statistics are cleared
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_op_stats(nnfw_session *session);
+
 #endif // __NNFW_EXPERIMENTAL_H__
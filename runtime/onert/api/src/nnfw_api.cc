@@ -367,3 +367,47 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->output_tensorindex(tensorname, index);
 }
+
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session, nnfw_execution_context **context)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->create_execution_context(context);
+}
+
+NNFW_STATUS nnfw_destroy_execution_context(nnfw_execution_context *context)
+{
+  delete context;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_input_with_context(nnfw_execution_context *context, uint32_t index,
+                                        NNFW_TYPE type, const void *buffer, size_t length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(context);
+  return context->set_input(index, type, buffer, length);
+}
+
+NNFW_STATUS nnfw_set_output_with_context(nnfw_execution_context *context, uint32_t index,
+                                         NNFW_TYPE type, void *buffer, size_t length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(context);
+  return context->set_output(index, type, buffer, length);
+}
+
+NNFW_STATUS nnfw_run_with_context(nnfw_execution_context *context)
+{
+  NNFW_RETURN_ERROR_IF_NULL(context);
+  return context->run();
+}
+
+NNFW_STATUS nnfw_get_op_stats(nnfw_session *session, nnfw_op_stats *stats, uint32_t *count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_op_stats(stats, count);
+}
+
+NNFW_STATUS nnfw_reset_op_stats(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_op_stats();
+}
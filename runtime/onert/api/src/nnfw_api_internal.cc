@@ -16,8 +16,12 @@
 
 #include "nnfw_api_internal.h"
 #include "CustomKernelRegistry.h"
+#include "backend/Backend.h"
 #include "compiler/Compiler.h"
+#include "compiler/ExecutorCache.h"
+#include "compiler/Rescheduler.h"
 #include "util/ConfigSource.h"
+#include "util/CpuAffinity.h"
 #include "util/Exceptions.h"
 #include "util/logging.h"
 #include "exec/Execution.h"
@@ -27,6 +31,7 @@
 #include "ir/OpCode.h"
 #include "util/TracingCtx.h"
 
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -157,9 +162,85 @@ void setConfigKeyValues(const CfgKeyValues &keyValues)
 
 } // namespace
 
+nnfw_execution_context::nnfw_execution_context(
+  std::unique_ptr<onert::util::TracingCtx> &&tracing_ctx,
+  std::unique_ptr<onert::exec::Execution> &&execution)
+  : _tracing_ctx{std::move(tracing_ctx)}, _execution{std::move(execution)}
+{
+  // DO NOTHING
+}
+
+nnfw_execution_context::~nnfw_execution_context() = default;
+
+NNFW_STATUS nnfw_execution_context::set_input(uint32_t index, NNFW_TYPE /*type*/,
+                                              const void *buffer, size_t length)
+{
+  if (!buffer && length != 0)
+  {
+    std::cerr << "Error during nnfw_execution_context::set_input : given buffer is NULL but the "
+                 "length is not 0"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->setInput(onert::ir::IOIndex(index), buffer, length);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_execution_context::set_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_execution_context::set_output(uint32_t index, NNFW_TYPE /*type*/, void *buffer,
+                                               size_t length)
+{
+  if (!buffer && length != 0)
+  {
+    std::cerr << "Error during nnfw_execution_context::set_output : given buffer is NULL but the "
+                 "length is not 0"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->setOutput(onert::ir::IOIndex(index), buffer, length);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_execution_context::set_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_execution_context::run()
+{
+  try
+  {
+    _execution->execute();
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    // Currently insufficient buffer always means output buffer.
+    std::cerr << "Error during nnfw_execution_context::run : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_execution_context::run : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 nnfw_session::nnfw_session()
-  : _subgraphs{nullptr}, _execution{nullptr},
-    _kernel_registry{std::make_shared<onert::api::CustomKernelRegistry>()}, _tracing_ctx{nullptr}
+  : _tracing_ctx{nullptr}, _subgraphs{nullptr}, _execution{nullptr},
+    _kernel_registry{std::make_shared<onert::api::CustomKernelRegistry>()}
 {
   // DO NOTHING
 }
@@ -347,9 +428,25 @@ NNFW_STATUS nnfw_session::prepare()
 
   try
   {
+    // Compilation consumes the model, so recompilation starts from an uncompiled copy
+    _model = _subgraphs->clone();
     _subgraphs.reset();
     std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
     _execution = std::make_unique<onert::exec::Execution>(executors);
+
+    // The model is not modified any more, so copies of it can be made in background as well
+    std::shared_ptr<const onert::ir::Subgraphs> model = _model;
+    auto clone_model = [model]() { return model->clone(); };
+    if (_compiler->options().he_adaptive)
+    {
+      _rescheduler =
+        std::make_unique<onert::compiler::Rescheduler>(clone_model, _compiler->options());
+    }
+    if (_compiler->options().executor_cache_size > 0 && !_compiler->options().disable_compile)
+    {
+      _executor_cache = std::make_unique<onert::compiler::ExecutorCache>(
+        clone_model, _compiler->options(), executors);
+    }
   }
   catch (const std::exception &e)
   {
@@ -372,6 +469,8 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    takeRescheduledExecutors();
+    takeCachedExecutors();
     _execution->execute();
   }
   catch (const onert::InsufficientBufferSizeException &e)
@@ -386,6 +485,9 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_ERROR;
   }
 
+  if (_rescheduler)
+    _rescheduler->notifyRun();
+
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
 }
@@ -399,6 +501,16 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  try
+  {
+    takeRescheduledExecutors();
+    takeCachedExecutors();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
   _execution->startExecute();
 
   _state = State::RUNNING;
@@ -416,6 +528,9 @@ NNFW_STATUS nnfw_session::await()
 
   _execution->waitFinish();
 
+  if (_rescheduler)
+    _rescheduler->notifyRun();
+
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
 }
@@ -829,6 +944,14 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.trace_filepath = value;
   }
+  else if (skey == config::TRACE_BUFFER_SIZE)
+  {
+    options.trace_buffer_size = toInt(value);
+  }
+  else if (skey == config::OP_STATS)
+  {
+    options.op_stats = toBool(value) ? std::make_shared<onert::exec::OpStats>() : nullptr;
+  }
   else if (skey == config::GRAPH_DOT_DUMP)
   {
     options.graph_dump_level = toInt(value);
@@ -849,10 +972,46 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.he_profiling_mode = toBool(value);
   }
+  else if (skey == config::ADAPTIVE_SCHEDULING)
+  {
+    options.he_adaptive = toBool(value);
+  }
+  else if (skey == config::ADAPTIVE_SCHEDULING_INTERVAL)
+  {
+    options.he_adaptive_interval = toInt(value);
+  }
+  else if (skey == config::ADAPTIVE_SCHEDULING_THRESHOLD)
+  {
+    options.he_adaptive_threshold = toInt(value);
+  }
   else if (skey == config::DISABLE_COMPILE)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::EXECUTOR_CACHE_SIZE)
+  {
+    options.executor_cache_size = toInt(value);
+  }
+  else if (skey == config::EXECUTOR_CACHE_MEMORY)
+  {
+    options.executor_cache_memory = toInt(value);
+  }
+  else if (skey == config::CPU_THREADS)
+  {
+    options.cpu_threads = toInt(value);
+  }
+  else if (skey == config::CPU_AFFINITY)
+  {
+    try
+    {
+      options.cpu_affinity = parseCpuList(value);
+    }
+    catch (const std::invalid_argument &e)
+    {
+      std::cerr << "Error during nnfw_session::set_config : " << e.what() << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1001,6 +1160,34 @@ bool nnfw_session::isStatePreparedOrFinishedRun()
   return isStatePrepared() || isStateFinishedRun();
 }
 
+void nnfw_session::takeRescheduledExecutors()
+{
+  if (!_rescheduler)
+    return;
+
+  std::unique_ptr<onert::util::TracingCtx> tracing_ctx;
+  auto executors = _rescheduler->takeExecutors(tracing_ctx);
+  if (executors)
+  {
+    // Previous executors are destroyed here, so replace their tracing context after that
+    _execution->setExecutors(executors);
+    _rescheduled_tracing_ctx = std::move(tracing_ctx);
+  }
+}
+
+void nnfw_session::takeCachedExecutors()
+{
+  if (!_executor_cache || !_execution->isInputShapeChanged())
+    return;
+
+  std::vector<onert::ir::Shape> input_shapes;
+  for (uint32_t i = 0; i < _execution->primary_subgraph().getInputs().size(); ++i)
+    input_shapes.emplace_back(_execution->getInputShape(onert::ir::IOIndex{i}));
+
+  // Executors compiled with the input shapes run them statically
+  _execution->setExecutors(_executor_cache->get(input_shapes));
+}
+
 NNFW_STATUS nnfw_session::input_tensorindex(const char *tensorname, uint32_t *index)
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, true);
@@ -1010,3 +1197,99 @@ NNFW_STATUS nnfw_session::output_tensorindex(const char *tensorname, uint32_t *i
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, false);
 }
+
+NNFW_STATUS nnfw_session::create_execution_context(nnfw_execution_context **context)
+{
+  if (!context)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : "
+              << "execution context should be created after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Each context compiles its own copy of the model so that it gets its own tensor memory.
+    // Constant data is shared with the copy, not loaded again.
+    auto subgraphs = _model->clone();
+    auto tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgraphs.get());
+    onert::compiler::Compiler compiler{subgraphs, tracing_ctx.get()};
+    compiler.options() = _compiler->options();
+    compiler.options().tracing_ctx = tracing_ctx.get();
+    subgraphs.reset();
+
+    auto executors = compiler.compile();
+    auto execution = std::make_unique<onert::exec::Execution>(executors);
+    *context =
+      new (std::nothrow) nnfw_execution_context(std::move(tracing_ctx), std::move(execution));
+    if (*context == nullptr)
+      return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : " << e.what()
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_op_stats(nnfw_op_stats *stats, uint32_t *count)
+{
+  if (!count)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!_compiler || !_compiler->options().op_stats)
+  {
+    std::cerr << "Error during nnfw_session::get_op_stats : "
+              << "OP_STATS should be enabled before prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    const auto entries = _compiler->options().op_stats->entries();
+    const auto capacity = stats ? *count : 0;
+    for (uint32_t i = 0; i < entries.size() && i < capacity; ++i)
+    {
+      const auto &entry = *entries[i];
+      auto &stat = stats[i];
+      const auto backend = entry.backend.load(std::memory_order_relaxed);
+      const auto backend_id = backend ? backend->config()->id() : std::string{};
+
+      stat.subgraph_index = entry.subg_index.value();
+      stat.op_index = entry.op_index.value();
+      snprintf(stat.name, NNFW_OP_STATS_MAX_NAME_LENGTH, "%s", entry.name.c_str());
+      snprintf(stat.backend, NNFW_OP_STATS_MAX_NAME_LENGTH, "%s", backend_id.c_str());
+      stat.count = entry.latency.count();
+      stat.bytes = entry.bytes * stat.count;
+      stat.total_ns = entry.latency.sum();
+      stat.p50_ns = entry.latency.percentile(0.5);
+      stat.p99_ns = entry.latency.percentile(0.99);
+      stat.max_ns = entry.latency.max();
+    }
+    *count = entries.size();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::get_op_stats : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_op_stats()
+{
+  if (!_compiler || !_compiler->options().op_stats)
+  {
+    std::cerr << "Error during nnfw_session::reset_op_stats : "
+              << "OP_STATS should be enabled before prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _compiler->options().op_stats->reset();
+  return NNFW_STATUS_NO_ERROR;
+}
@@ -44,9 +44,28 @@ class Subgraphs;
 namespace compiler
 {
 class Compiler;
+class ExecutorCache;
+class Rescheduler;
 } // namespace compiler
 } // namespace onert
 
+struct nnfw_execution_context
+{
+public:
+  nnfw_execution_context(std::unique_ptr<onert::util::TracingCtx> &&tracing_ctx,
+                         std::unique_ptr<onert::exec::Execution> &&execution);
+  ~nnfw_execution_context();
+
+  NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
+  NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
+  NNFW_STATUS run();
+
+private:
+  // NOTE Executors refer to the tracing context, so it must be destroyed after the execution
+  std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
+  std::unique_ptr<onert::exec::Execution> _execution;
+};
+
 struct nnfw_session
 {
 private:
@@ -139,6 +158,9 @@ public:
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS output_tensorindex(const char *tensorname, uint32_t *index);
+  NNFW_STATUS create_execution_context(nnfw_execution_context **context);
+  NNFW_STATUS get_op_stats(nnfw_op_stats *stats, uint32_t *count);
+  NNFW_STATUS reset_op_stats();
 
 private:
   const onert::ir::Graph *primary_subgraph();
@@ -148,15 +170,24 @@ private:
   bool isStateRunning();
   bool isStateFinishedRun();
   bool isStatePreparedOrFinishedRun();
+  void takeRescheduledExecutors();
+  void takeCachedExecutors();
 
 private:
   State _state{State::INITIALIZED};
+  // NOTE Executors refer to the tracing contexts, so they must be destroyed after the executors
+  std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
+  // Tracing context of executors taken from _rescheduler
+  std::unique_ptr<onert::util::TracingCtx> _rescheduled_tracing_ctx;
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
   std::unique_ptr<onert::compiler::Compiler> _compiler;
   std::unique_ptr<onert::exec::Execution> _execution;
+  // Uncompiled copy of the model, which execution contexts and recompilation clone. Constant data
+  // is shared by all the clones, and is kept alive even if backends release their references.
+  std::shared_ptr<onert::ir::Subgraphs> _model;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
-
-  std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
+  std::unique_ptr<onert::compiler::Rescheduler> _rescheduler;
+  std::unique_ptr<onert::compiler::ExecutorCache> _executor_cache;
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
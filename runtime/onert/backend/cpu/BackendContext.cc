@@ -24,6 +24,40 @@
 #include "ir/OperandIndexSequence.h"
 #include "backend/basic/BackendContextHelpers.h"
 
+#include <cker/eigen/EigenSupport.h>
+
+namespace
+{
+
+using namespace onert;
+
+// Runs a kernel with the Eigen thread pool of the backend context instead of the process-wide one
+class EigenContextFunction final : public exec::IFunction
+{
+public:
+  EigenContextFunction(std::unique_ptr<exec::IFunction> fn,
+                       nnfw::cker::eigen_support::EigenContext *eigen_context)
+    : _fn{std::move(fn)}, _eigen_context{eigen_context}
+  {
+    assert(_fn);
+    assert(_eigen_context);
+  }
+
+  void run() override
+  {
+    nnfw::cker::eigen_support::ScopedEigenContext scope{_eigen_context};
+    _fn->run();
+  }
+
+  void prepare() override { _fn->prepare(); }
+
+private:
+  std::unique_ptr<exec::IFunction> _fn;
+  nnfw::cker::eigen_support::EigenContext *_eigen_context;
+};
+
+} // namespace
+
 namespace onert
 {
 namespace backend
@@ -31,7 +65,13 @@ namespace backend
 namespace cpu
 {
 
-ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
+ITensorRegistry *BackendContext::genTensors()
+{
+  // NOTE Tensors are planned and allocated in genKernels() after kernels register their scratch
+  //      buffers, so that scratch buffers share the memory plan with the tensors
+  basic::registerTensors(*this);
+  return tensor_registry.get();
+}
 
 FunctionMap BackendContext::genKernels()
 {
@@ -40,9 +80,17 @@ FunctionMap BackendContext::genKernels()
   for (auto op_ind : _data.op_order)
   {
     auto fn_seq = kernel_gen->generate(op_ind);
+    if (_external_context->eigen_context())
+      fn_seq->wrap<EigenContextFunction>(_external_context->eigen_context());
     ret.emplace_back(op_ind, std::move(fn_seq));
   }
 
+  basic::allocateTensors(*this);
+
+  // Static tensors must be allocated to be referenced
+  for (auto op_ind : _data.op_order)
+    kernel_gen->increaseTensorRefs(op_ind);
+
   basic::initConsts(*this);
 
   // NOTE For memory optimization, we want to free some operand data
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExternalContext.h"
+
+#include <cker/eigen/EigenSupport.h>
+#include <cker/ruy/RuySupport.h>
+#include <util/CpuAffinity.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+ExternalContext::ExternalContext(int num_threads, const std::vector<uint32_t> &cpu_affinity)
+  : _ruy_context(new ruy::Context), _eigen_context(nullptr)
+{
+  if (num_threads < 1)
+  {
+    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    return;
+  }
+
+  // Size ruy and Eigen with the same number of threads, as a kernel runs on either of them
+  setMaxNumThreads(num_threads);
+  if (!cpu_affinity.empty())
+  {
+    onert::util::ScopedThreadAffinity affinity{cpu_affinity};
+    nnfw::cker::ruy_support::CreateWorkerThreads(_ruy_context.get());
+  }
+  _eigen_context = std::make_unique<nnfw::cker::eigen_support::EigenContext>(
+    num_threads, [cpu_affinity]() { onert::util::setThreadAffinity(cpu_affinity); });
+}
+
+ExternalContext::~ExternalContext() = default;
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
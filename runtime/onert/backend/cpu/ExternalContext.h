@@ -20,6 +20,20 @@
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace eigen_support
+{
+struct EigenContext;
+} // namespace eigen_support
+} // namespace cker
+} // namespace nnfw
+
 namespace onert
 {
 namespace backend
@@ -33,10 +47,14 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
-  {
-    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
-  }
+  /**
+   * @brief Construct a new ExternalContext object
+   * @param[in] num_threads  Number of threads for ruy and Eigen, -1 to use RUY_THREADS for ruy
+   *                         and the process-wide Eigen thread pool
+   * @param[in] cpu_affinity CPUs which ruy and Eigen threads run on, empty for any CPU
+   */
+  ExternalContext(int num_threads = -1, const std::vector<uint32_t> &cpu_affinity = {});
+  ~ExternalContext();
 
   void setMaxNumThreads(int max_num_threads)
   {
@@ -47,8 +65,15 @@ public:
 
   ruy::Context *ruy_context() const { return _ruy_context.get(); }
 
+  /**
+   * @brief Get Eigen context which kernels of this context run with
+   * @return nullptr if kernels use the process-wide Eigen context
+   */
+  nnfw::cker::eigen_support::EigenContext *eigen_context() const { return _eigen_context.get(); }
+
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
+  std::unique_ptr<nnfw::cker::eigen_support::EigenContext> _eigen_context;
 };
 
 } // namespace cpu
@@ -59,6 +59,7 @@
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
@@ -234,6 +235,13 @@ KernelGenerator::KernelGenerator(
   // DO NOTHING
 }
 
+template <typename T_Layer> void KernelGenerator::registerScratch(T_Layer &fn)
+{
+  const auto size = fn.scratchSize();
+  if (size > 0)
+    fn.setScratchBuffer(_tensor_builder->registerScratch(_current_op_ind, size));
+}
+
 std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationIndex ind)
 {
   auto ret = std::make_unique<exec::FunctionSequence>();
@@ -253,6 +261,7 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
     ret->dynamic_tensor_ctx(dyn_ctx);
   }
 
+  _current_op_ind = ind;
   auto &op = _graph.operations().at(ind);
   op.accept(*this);
   assert(_return_fn); // _return_fn must have been generated
@@ -265,14 +274,22 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
     {
       assert(portable_tensor->layout() == ir::Layout::NHWC);
     }
+  }
+  // NOTE References of native tensors are counted by increaseTensorRefs() after allocation
+  return ret;
+}
 
+void KernelGenerator::increaseTensorRefs(ir::OperationIndex op_ind)
+{
+  auto &op = _graph.operations().at(op_ind);
+  for (auto ind : (op.getInputs() | ir::Remove::UNDEFINED) + op.getOutputs())
+  {
     auto tensor = _tensor_reg->getNativeTensor(ind);
     if (tensor)
     {
       tensor->increase_ref();
     }
   }
-  return ret;
 }
 
 void KernelGenerator::visit(const ir::operation::AddN &node)
@@ -336,6 +353,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor);
+  registerScratch(*fn);
 
   _return_fn = std::move(fn);
 }
@@ -459,6 +477,7 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
 
   fn->configure(input_tensor, weight_tensor, bias_tensor, activation, weights_format, output_tensor,
                 _external_context);
+  registerScratch(*fn);
 
   _return_fn = std::move(fn);
 }
@@ -829,6 +848,43 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+
+  if (_ctx.at(ifm_index).info().isDynamic() || _ctx.at(ker_index).info().isDynamic() ||
+      _ctx.at(ofm_index).info().isDynamic())
+    throw std::runtime_error{"TransposeConv: dynamic shape is not supported"};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  const auto stride = node.param().stride;
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  // NOTE The padding of TransposeConv is calculated as Conv from ofm to ifm
+  const auto padding =
+    ir::calculatePadding(node.param().padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  fn->configure(ifm_tensor, ker_tensor, padding.left, padding.top, stride.horizontal,
+                stride.vertical, ofm_tensor, _external_context);
+  registerScratch(*fn);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reduce &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1190,7 +1246,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
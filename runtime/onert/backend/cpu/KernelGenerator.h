@@ -43,6 +43,8 @@ public:
                   const std::shared_ptr<ExternalContext> &external_context);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex op_ind) override;
+  // Count references of native tensors used by the operation, which must be allocated already
+  void increaseTensorRefs(ir::OperationIndex op_ind);
 
   void visit(const ir::operation::AddN &) override;
   void visit(const ir::operation::ArgMinMax &) override;
@@ -94,8 +96,12 @@ public:
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::Transpose &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Unpack &) override;
 
+private:
+  template <typename T_Layer> void registerScratch(T_Layer &fn);
+
 private:
   const ir::Operands &_ctx;
   const ir::Operations &_operations_ctx;
@@ -104,6 +110,7 @@ private:
   std::shared_ptr<basic::TensorRegistry> _tensor_reg;
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
   const std::shared_ptr<ExternalContext> _external_context;
+  ir::OperationIndex _current_op_ind;
 };
 
 } // namespace cpu
@@ -29,7 +29,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _kernel(new nnfw::cker::BatchMatMul()), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -45,13 +45,14 @@ void BatchMatMulLayer::batchMatMulFloat32()
 
   // TODO implement for constant input
 
-  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
   batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+                     _adj_y, output_shape, getBuffer<float>(_output),
+                     _external_context->ruy_context());
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,6 +63,7 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
 }
 
 void BatchMatMulLayer::run()
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -49,7 +50,7 @@ public:
   void batchMatMulFloat32();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -62,6 +63,7 @@ private:
   bool _adj_y;
 
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -34,7 +34,7 @@ ConvolutionLayer::ConvolutionLayer()
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
     _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
     _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-    _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+    _conv_kernel(new nnfw::cker::Conv()), _scratch(nullptr), _prepare(false)
 {
   // DO NOTHING
 }
@@ -150,6 +150,18 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _output = output;
 }
 
+size_t ConvolutionLayer::scratchSize() const
+{
+  // Only the uint8 kernel with static shapes uses im2col buffer of a known size
+  if (_input->data_type() != OperandType::QUANT_UINT8_ASYMM || _input->is_dynamic() ||
+      _kernel->is_dynamic() || _output->is_dynamic())
+    return 0;
+
+  return nnfw::cker::Conv::im2colBufferSize(getShape(_input), getShape(_kernel), getShape(_output),
+                                            _strideWidth, _strideHeight, _dilationWidthFactor,
+                                            _dilationHeightFactor);
+}
+
 void ConvolutionLayer::run()
 {
   prepare();
@@ -207,6 +219,11 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (_scratch)
+  {
+    kernel.setIm2colBuffer(_scratch->buffer(), _scratch->size());
+  }
+
   if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_CONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include <backend/basic/ScratchBuffer.h>
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -62,6 +63,12 @@ public:
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
                  IPortableTensor *output);
 
+  /**
+   * @brief Get the size of scratch buffer in bytes which this layer needs to run, 0 if none
+   */
+  size_t scratchSize() const;
+  void setScratchBuffer(const basic::ScratchBuffer *scratch) { _scratch = scratch; }
+
   void run() override;
 
   void prepare() override;
@@ -86,6 +93,7 @@ private:
   ir::Activation _activation;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  const basic::ScratchBuffer *_scratch;
 
   bool _prepare;
 };
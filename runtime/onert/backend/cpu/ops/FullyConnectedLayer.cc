@@ -33,7 +33,7 @@ namespace ops
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false)
+    _scratch(nullptr), _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false)
 {
   // DO NOTHING
 }
@@ -85,7 +85,14 @@ void FullyConnectedLayer::fullyConnectedHybrid()
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
   if (!temp_arena.prepared)
   {
-    temp_arena.prepare(getShape(_input), getShape(_weights));
+    const auto input_shape = getShape(_input);
+    const auto weights_shape = getShape(_weights);
+    const auto output_shape = getShape(_output);
+    const bool use_scratch =
+      _scratch && _scratch->size() >=
+                    nnfw::cker::FCTempArena::bufferSize(input_shape, weights_shape, output_shape);
+    temp_arena.prepare(input_shape, weights_shape, output_shape,
+                       use_scratch ? _scratch->buffer() : nullptr);
   }
 
   nnfw::cker::FullyConnectedParams op_params;
@@ -210,6 +217,16 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _external_context = external_context;
 }
 
+size_t FullyConnectedLayer::scratchSize() const
+{
+  // Only the hybrid kernel needs temporaries
+  if (!_is_hybrid || _input->is_dynamic() || _output->is_dynamic())
+    return 0;
+
+  return nnfw::cker::FCTempArena::bufferSize(getShape(_input), getShape(_weights),
+                                             getShape(_output));
+}
+
 void FullyConnectedLayer::run()
 {
   if (_is_hybrid)
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_FULLYCONNECTEDLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include <backend/basic/ScratchBuffer.h>
 #include "../ExternalContext.h"
 #include "OperationUtils.h"
 
@@ -62,6 +63,12 @@ public:
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
                  const std::shared_ptr<ExternalContext> &external_context);
 
+  /**
+   * @brief Get the size of scratch buffer in bytes which this layer needs to run, 0 if none
+   */
+  size_t scratchSize() const;
+  void setScratchBuffer(const basic::ScratchBuffer *scratch) { _scratch = scratch; }
+
   void run() override;
 
   void prepare() override;
@@ -74,6 +81,7 @@ private:
 
   ir::Activation _activation;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+  const basic::ScratchBuffer *_scratch;
 
   std::shared_ptr<ExternalContext> _external_context;
 
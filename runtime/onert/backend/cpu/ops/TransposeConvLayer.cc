@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+#include "OperationUtils.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+  : _input(nullptr), _kernel(nullptr), _output(nullptr), _paddingLeft(0), _paddingTop(0),
+    _strideWidth(0), _strideHeight(0), _hwoi_kernel(), _col2im(), _scratch(nullptr),
+    _external_context(nullptr), _prepare(false)
+{
+  // DO NOTHING
+}
+
+template <typename T> const T *TransposeConvLayer::hwoiKernel()
+{
+  // Constant kernel is reordered only once in prepare()
+  if (!_kernel->is_constant())
+  {
+    _hwoi_kernel.resize(_kernel->total_size());
+    nnfw::cker::optimized::TransposeConvFilterToHWOI(
+      getShape(_kernel), getBuffer<T>(_kernel), reinterpret_cast<T *>(_hwoi_kernel.data()));
+  }
+  return reinterpret_cast<const T *>(_hwoi_kernel.data());
+}
+
+template <typename AccT> AccT *TransposeConvLayer::col2imBuffer()
+{
+  const size_t size =
+    nnfw::cker::optimized::TransposeConvCol2imSize(getShape(_input), getShape(_kernel)) *
+    sizeof(AccT);
+  if (_scratch && _scratch->size() >= size)
+    return reinterpret_cast<AccT *>(_scratch->buffer());
+
+  if (_col2im.size() < size)
+    _col2im.resize(size);
+  return reinterpret_cast<AccT *>(_col2im.data());
+}
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.float_activation_min = std::numeric_limits<float>::lowest();
+  op_params.float_activation_max = std::numeric_limits<float>::max();
+
+  nnfw::cker::optimized::TransposeConv(
+    op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+    hwoiKernel<float>(), _kernel->is_constant(), getShape(_output), getBuffer<float>(_output),
+    col2imBuffer<float>(), _external_context->ruy_context());
+}
+
+void TransposeConvLayer::transposeConvQuant8()
+{
+  double real_multiplier = 0.0;
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  GetQuantizedConvolutionMultiplier(_input, _kernel, nullptr, _output, &real_multiplier);
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.weights_offset = -_kernel->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = std::numeric_limits<uint8_t>::min();
+  op_params.quantized_activation_max = std::numeric_limits<uint8_t>::max();
+
+  nnfw::cker::optimized::TransposeConv(
+    op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
+    hwoiKernel<uint8_t>(), _kernel->is_constant(), getShape(_output), getBuffer<uint8_t>(_output),
+    col2imBuffer<int32_t>(), _external_context->ruy_context());
+}
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   const uint32_t paddingLeft, const uint32_t paddingTop,
+                                   const uint32_t strideWidth, const uint32_t strideHeight,
+                                   IPortableTensor *output,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _kernel = kernel;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+  _external_context = external_context;
+}
+
+size_t TransposeConvLayer::scratchSize() const
+{
+  // Both float and int32 accumulators are 4 bytes
+  static_assert(sizeof(float) == sizeof(int32_t), "Accumulator sizes differ");
+  if (_input->is_dynamic() || _kernel->is_dynamic())
+    return 0;
+
+  return nnfw::cker::optimized::TransposeConvCol2imSize(getShape(_input), getShape(_kernel)) *
+         sizeof(float);
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  if (_kernel->is_constant())
+  {
+    _hwoi_kernel.resize(_kernel->total_size());
+    if (_kernel->data_type() == OperandType::FLOAT32)
+    {
+      nnfw::cker::optimized::TransposeConvFilterToHWOI(
+        getShape(_kernel), getBuffer<float>(_kernel),
+        reinterpret_cast<float *>(_hwoi_kernel.data()));
+    }
+    else if (_kernel->data_type() == OperandType::QUANT_UINT8_ASYMM)
+    {
+      nnfw::cker::optimized::TransposeConvFilterToHWOI(getShape(_kernel),
+                                                       getBuffer<uint8_t>(_kernel),
+                                                       _hwoi_kernel.data());
+    }
+  }
+  _prepare = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
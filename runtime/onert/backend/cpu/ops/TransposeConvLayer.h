@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include <backend/basic/ScratchBuffer.h>
+#include "../ExternalContext.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class TransposeConvLayer : public ::onert::exec::IFunction
+{
+public:
+  TransposeConvLayer();
+
+public:
+  void transposeConvFloat32();
+
+  void transposeConvQuant8();
+
+  void configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                 const uint32_t paddingLeft, const uint32_t paddingTop,
+                 const uint32_t strideWidth, const uint32_t strideHeight, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  /**
+   * @brief Get the size of scratch buffer in bytes which this layer needs to run, 0 if none
+   */
+  size_t scratchSize() const;
+  void setScratchBuffer(const basic::ScratchBuffer *scratch) { _scratch = scratch; }
+
+  void run() override;
+
+  void prepare() override;
+
+private:
+  template <typename T> const T *hwoiKernel();
+  template <typename AccT> AccT *col2imBuffer();
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_kernel;
+  IPortableTensor *_output;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  // Kernel reordered into [height, width, depth_out, depth_in]
+  std::vector<uint8_t> _hwoi_kernel;
+  // Own col2im buffer used when no scratch buffer is given
+  std::vector<uint8_t> _col2im;
+  const basic::ScratchBuffer *_scratch;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  bool _prepare;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
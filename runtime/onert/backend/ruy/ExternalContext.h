@@ -18,7 +18,11 @@
 #define __ONERT_BACKEND_RUY_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/CpuAffinity.h>
 #include <ruy/context.h>
+#include "ruy/RuySupport.h"
+
+#include <vector>
 
 namespace onert
 {
@@ -33,9 +37,21 @@ private:
   static const int kDefaultNumThreadpoolThreads = 4;
 
 public:
-  ExternalContext() : _ruy_context(new ::ruy::Context)
+  /**
+   * @param[in] num_threads  Number of threads for ruy, -1 to use RUY_THREADS
+   * @param[in] cpu_affinity CPUs which ruy threads run on, empty for any CPU
+   */
+  ExternalContext(int num_threads = -1, const std::vector<uint32_t> &cpu_affinity = {})
+    : _ruy_context(new ::ruy::Context)
   {
-    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    setMaxNumThreads(num_threads > 0
+                       ? num_threads
+                       : onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    if (!cpu_affinity.empty())
+    {
+      onert::util::ScopedThreadAffinity affinity{cpu_affinity};
+      nnfw::ruy::ruy_support::CreateWorkerThreads(_ruy_context.get());
+    }
   }
 
   void setMaxNumThreads(int max_num_threads)
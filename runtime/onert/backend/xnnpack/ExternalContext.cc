@@ -16,6 +16,8 @@
 
 #include "ExternalContext.h"
 
+#include <util/CpuAffinity.h>
+
 #include <cassert>
 
 namespace onert
@@ -25,8 +27,20 @@ namespace backend
 namespace xnnpack
 {
 
-ExternalContext::ExternalContext(size_t num_threads)
-  : _threadpool(pthreadpool_create(num_threads), pthreadpool_destroy)
+namespace
+{
+
+pthreadpool *createThreadPool(size_t num_threads, const std::vector<uint32_t> &cpu_affinity)
+{
+  // Worker threads inherit the affinity of the thread which creates them
+  onert::util::ScopedThreadAffinity affinity{cpu_affinity};
+  return pthreadpool_create(num_threads);
+}
+
+} // namespace
+
+ExternalContext::ExternalContext(size_t num_threads, const std::vector<uint32_t> &cpu_affinity)
+  : _threadpool(createThreadPool(num_threads, cpu_affinity), pthreadpool_destroy)
 {
   assert(_threadpool);
 }
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_XNNPACK_EXTERNAL_CONTEXT_H__
 
 #include <memory>
+#include <vector>
 #include <xnnpack.h>
 
 namespace onert
@@ -30,7 +31,11 @@ namespace xnnpack
 class ExternalContext
 {
 public:
-  ExternalContext(size_t num_threads);
+  /**
+   * @param[in] num_threads  Number of threads in the pool
+   * @param[in] cpu_affinity CPUs which the pool threads run on, empty for any CPU
+   */
+  ExternalContext(size_t num_threads, const std::vector<uint32_t> &cpu_affinity = {});
 
 public:
   pthreadpool *getThreadPool() { return _threadpool.get(); }
@@ -49,6 +49,10 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Number of threads for CPU kernels, -1 to use the backend's own setting */
+  int cpu_threads = -1;
+  /* CPUs which kernel threads run on, empty for any CPU */
+  std::vector<uint32_t> cpu_affinity;
 };
 
 class BackendContext
@@ -38,15 +38,28 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct a new Allocator object with a buffer allocated already
+   * @param base     Buffer to own
+   * @param capacity Size of the buffer
+   */
+  Allocator(std::unique_ptr<uint8_t[]> base, uint32_t capacity);
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
   uint8_t *base() const { return _base.get(); }
+  uint32_t capacity() const { return _capacity; }
   void release() { _base.reset(); }
+  /**
+   * @brief Give up the ownership of the buffer, so that the buffer can be reused by others
+   * @return The buffer, or nullptr if it is released already
+   */
+  std::unique_ptr<uint8_t[]> take() { return std::move(_base); }
 
 private:
   std::unique_ptr<uint8_t[]> _base;
+  uint32_t _capacity;
 };
 
 } // namespace basic
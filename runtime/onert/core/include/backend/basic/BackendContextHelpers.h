@@ -144,6 +144,10 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       }
     }
 
+    // Scratch buffer of the operation lives while the operation runs, so it must not overlap
+    // with its inputs and outputs
+    tensor_builder->notifyScratchFirstUse(op_ind);
+
     for (const auto &ind : op_inputs)
     {
       if (ctx.external_operands().contains(ind))
@@ -159,6 +163,8 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
         tensor_builder->notifyLastUse(ind);
       }
     }
+
+    tensor_builder->notifyScratchLastUse(op_ind);
   }
 
   for (auto ind : operands_last_until_end)
@@ -185,13 +191,11 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
                 [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
 }
 
-template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContext &ctx)
+template <typename T_BackendContext> void registerTensors(T_BackendContext &ctx)
 {
   const ir::Graph &graph = *ctx.graph();
   auto tensor_builder = ctx.tensor_builder;
 
-  auto model_io =
-    (graph.getInputs() + graph.getOutputs()) | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED;
   graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
     if (ctx.external_operands().contains(ind))
       return;
@@ -201,6 +205,17 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
                                  obj.isConstant()};
     tensor_builder->registerTensorInfo(ind, backend_info, ir::Layout::NHWC);
   });
+}
+
+/**
+ * @brief Plan and allocate the tensors registered by registerTensors()
+ *
+ * Scratch buffers registered before this call are planned together with the tensors.
+ */
+template <typename T_BackendContext> void allocateTensors(T_BackendContext &ctx)
+{
+  const ir::Graph &graph = *ctx.graph();
+  auto tensor_builder = ctx.tensor_builder;
 
   // TODO Get compiler options from compiler, and use it rather than getting it from Env
   if (util::getConfigString(util::config::EXECUTOR) == "Linear")
@@ -215,9 +230,18 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
       if (tensor_builder->isRegistered(ind))
         tensor_builder->notifyFirstUse(ind);
     });
+    // Operations may run concurrently, so scratch buffers must not share memory either
+    for (const auto op_ind : ctx.data().op_order)
+      tensor_builder->notifyScratchFirstUse(op_ind);
   }
 
   tensor_builder->allocate();
+}
+
+template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContext &ctx)
+{
+  registerTensors(ctx);
+  allocateTensors(ctx);
 
   return ctx.tensor_registry.get();
 }
@@ -19,6 +19,10 @@
 
 #include "ir/OperandIndexMap.h"
 
+#include <functional>
+#include <ostream>
+#include <unordered_map>
+
 namespace onert
 {
 namespace backend
@@ -35,24 +39,65 @@ struct Block
   size_t size;
 };
 
+/**
+ * @brief Index of a memory plan, which is for an operand or for the scratch buffer of an operation
+ */
+class PlanIndex
+{
+public:
+  PlanIndex() = default;
+  // Operands are planned by their own indices
+  PlanIndex(const ir::OperandIndex &ind) : _operand{ind}, _operation{} {}
+
+  static PlanIndex scratch(const ir::OperationIndex &ind) { return PlanIndex{ind}; }
+
+public:
+  bool isScratch() const { return _operation.valid(); }
+  const ir::OperandIndex &operand() const { return _operand; }
+  const ir::OperationIndex &operation() const { return _operation; }
+
+  bool operator==(const PlanIndex &other) const
+  {
+    return _operand == other._operand && _operation == other._operation;
+  }
+  bool operator!=(const PlanIndex &other) const { return !(*this == other); }
+
+private:
+  explicit PlanIndex(const ir::OperationIndex &ind) : _operand{}, _operation{ind} {}
+
+private:
+  // Only one of them is valid
+  ir::OperandIndex _operand;
+  ir::OperationIndex _operation;
+};
+
+inline std::ostream &operator<<(std::ostream &o, const PlanIndex &ind)
+{
+  if (ind.isScratch())
+    return o << "scratch of " << ind.operation();
+  return o << ind.operand();
+}
+
+template <typename T> using PlanIndexMap = std::unordered_map<PlanIndex, T>;
+
 /**
  * @brief Interface to plan memory
  */
 struct IMemoryPlanner
 {
-  using MemoryPlans = ir::OperandIndexMap<Block>;
+  using MemoryPlans = PlanIndexMap<Block>;
 
   /**
-   * @brief Claim memory for operand
-   * @param[in] index The operand index
+   * @brief Claim memory for operand or scratch buffer
+   * @param[in] index The plan index
    * @param[in] size The size of the memory
    */
-  virtual void claim(const ir::OperandIndex &, size_t) = 0;
+  virtual void claim(const PlanIndex &, size_t) = 0;
   /**
-   * @brief Release memory for operand
-   * @param[in] index The operand index
+   * @brief Release memory for operand or scratch buffer
+   * @param[in] index The plan index
    */
-  virtual void release(const ir::OperandIndex &) = 0;
+  virtual void release(const PlanIndex &) = 0;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -71,4 +116,19 @@ struct IMemoryPlanner
 } // namespace backend
 } // namespace onert
 
+namespace std
+{
+
+template <> struct hash<onert::backend::basic::PlanIndex>
+{
+  size_t operator()(const onert::backend::basic::PlanIndex &ind) const noexcept
+  {
+    if (ind.isScratch())
+      return ~hash<onert::ir::OperationIndex>()(ind.operation());
+    return hash<onert::ir::OperandIndex>()(ind.operand());
+  }
+};
+
+} // namespace std
+
 #endif // __ONERT_BACKEND_IMEMORY_PLANNER_H__
@@ -20,6 +20,9 @@
 #include "Allocator.h"
 #include "IMemoryPlanner.h"
 
+#include <map>
+#include <mutex>
+
 namespace onert
 {
 namespace backend
@@ -38,11 +41,11 @@ public:
   virtual ~MemoryManager() = default;
 
   void allocate(void);
-  uint8_t *getBuffer(const ir::OperandIndex &ind) const;
+  uint8_t *getBuffer(const PlanIndex &ind) const;
   void deallocate(void) { _mem_alloc->release(); }
 
-  void claimPlan(const ir::OperandIndex &ind, uint32_t size);
-  void releasePlan(const ir::OperandIndex &ind);
+  void claimPlan(const PlanIndex &ind, uint32_t size);
+  void releasePlan(const PlanIndex &ind);
 
 private:
   IMemoryPlanner *createMemoryPlanner();
@@ -54,6 +57,33 @@ private:
   std::shared_ptr<Allocator> _mem_alloc;
 };
 
+/**
+ * @brief Counters of allocations by a DynamicMemoryManager, or summed up over some of them
+ */
+struct DynamicMemoryStats
+{
+  // Number of allocation requests and the bytes requested by them
+  uint64_t num_allocations = 0;
+  uint64_t allocated_bytes = 0;
+  // Number of the requests which are not served by the buffer pool, but by heap allocation
+  uint64_t num_heap_allocations = 0;
+
+  DynamicMemoryStats &operator+=(const DynamicMemoryStats &rhs)
+  {
+    num_allocations += rhs.num_allocations;
+    allocated_bytes += rhs.allocated_bytes;
+    num_heap_allocations += rhs.num_heap_allocations;
+    return *this;
+  }
+};
+
+/**
+ * @brief Memory manager for dynamic tensors
+ *
+ * Deallocated buffers are kept in a pool and reused by later allocations of the same or a bit
+ * smaller size, so that resizing tensors at every run does not allocate heap memory every time.
+ * The pool does not hold more than the peak amount of the memory in use.
+ */
 class DynamicMemoryManager
 {
 public:
@@ -64,8 +94,20 @@ public:
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  DynamicMemoryStats stats() const;
+
+private:
+  void recycle(Allocator &alloc);
+
 private:
+  mutable std::mutex _mutex;
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  // Buffers to reuse, ordered by capacity
+  std::multimap<uint32_t, std::unique_ptr<uint8_t[]>> _pool;
+  uint64_t _pooled_bytes = 0;
+  uint64_t _in_use_bytes = 0;
+  uint64_t _peak_in_use_bytes = 0;
+  DynamicMemoryStats _stats;
 };
 
 } // namespace basic
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_SCRATCH_BUFFER_H__
+#define __ONERT_BACKEND_BASIC_SCRATCH_BUFFER_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Temporary memory that a kernel needs only while it runs
+ *
+ * Scratch buffers are planned by StaticTensorManager together with non-constant tensors, and
+ * live exactly as long as the operation that requested them. The buffer is valid after
+ * TensorBuilder::allocate() is called.
+ */
+class ScratchBuffer
+{
+public:
+  ScratchBuffer(size_t size) : _size{size}, _buffer{nullptr} {}
+
+public:
+  size_t size() const { return _size; }
+  uint8_t *buffer() const { return _buffer; }
+  void setBuffer(uint8_t *buffer) { _buffer = buffer; }
+
+private:
+  size_t _size;
+  uint8_t *_buffer;
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_SCRATCH_BUFFER_H__
@@ -19,9 +19,11 @@
 
 #include "backend/basic/DynamicTensorManager.h"
 #include "backend/basic/MemoryManager.h"
+#include "backend/basic/ScratchBuffer.h"
 #include "backend/basic/TensorRegistry.h"
 #include "ir/OperandIndexMap.h"
 #include "ir/OperandInfo.h"
+#include "ir/OperationIndexMap.h"
 #include "TensorRegistry.h"
 
 namespace onert
@@ -49,6 +51,18 @@ public:
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
+  /**
+   * @brief Create a scratch buffer for an operation
+   * @param[in] ind  Index of the operation that owns the scratch buffer
+   * @param[in] size Size of the scratch buffer in bytes
+   * @return ScratchBuffer whose buffer is set by allocateNonconsts()
+   */
+  ScratchBuffer *buildScratch(const ir::OperationIndex &ind, size_t size);
+  bool hasScratch(const ir::OperationIndex &ind) const;
+
+  void claimScratchPlan(const ir::OperationIndex &ind);
+  void releaseScratchPlan(const ir::OperationIndex &ind);
+
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
 private:
@@ -56,6 +70,7 @@ private:
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
   DynamicTensorManager *_dynamic_tensor_manager;
+  ir::OperationIndexMap<std::unique_ptr<ScratchBuffer>> _scratches;
 };
 
 } // namespace basic
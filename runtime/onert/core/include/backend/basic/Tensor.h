@@ -71,6 +71,7 @@ public:
 
 public:
   uint8_t *buffer() const override { return _buffer; }
+  DynamicMemoryManager *dynamic_mem_mgr() const { return _dynamic_mem_mgr; }
   /**
    * @brief Get dimension by index
    *
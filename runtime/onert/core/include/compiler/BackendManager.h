@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <map>
+#include <mutex>
 
 #include "ir/Operands.h"
 #include "backend/Backend.h"
@@ -44,12 +45,17 @@ public:
   const backend::builtin::Backend *getBuiltin() const;
   const std::vector<const backend::Backend *> getAll() const
   {
+    std::lock_guard<std::mutex> lock{_mutex};
     std::vector<const backend::Backend *> v;
     for (const auto &p : _gen_map)
       v.emplace_back(p.second.get());
     return v;
   }
-  size_t num_backends() const { return _gen_map.size(); }
+  size_t num_backends() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _gen_map.size();
+  }
   /**
    * @brief load backend plugin
    *
@@ -63,6 +69,8 @@ private:
   BackendManager();
 
 private:
+  // Backends are looked up and loaded by compilations running in background as well
+  mutable std::mutex _mutex;
   std::map<std::string, std::unique_ptr<void, dlhandle_destroy_t>> _handle_map;
   std::map<std::string, std::unique_ptr<backend::Backend, backend_destroy_t>> _gen_map;
   backend::builtin::Backend *_builtin{nullptr};
@@ -24,11 +24,17 @@
 
 #include "ir/Graph.h"
 #include "exec/IExecutor.h"
+#include "exec/OpStats.h"
 #include "util/TracingCtx.h"
 
 namespace onert
 {
 
+namespace exec
+{
+class ExecTime;
+} // namespace exec
+
 namespace compiler
 {
 
@@ -52,13 +58,35 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  int trace_buffer_size;      //< Number of trace events kept per thread
+  // Execution statistics to gather while running, nullptr not to gather
+  std::shared_ptr<exec::OpStats> op_stats;
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   std::string executor;       //< Executor name to use
+  // Number of worker threads for each backend id, used by Parallel executor only
+  std::unordered_map<std::string, uint32_t> parallel_threads;
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool he_adaptive;       //< Whether to re-schedule with exec times sampled while running
+  // Number of runs between re-schedulings in adaptive mode
+  int he_adaptive_interval;
+  // Improvement of estimated makespan in percent to take a new schedule in adaptive mode
+  int he_adaptive_threshold;
+  // Exec times which HEScheduler schedules with, HEScheduler loads its own if nullptr
+  std::shared_ptr<exec::ExecTime> he_exec_time;
+  // Exec times which executors sample exec times of operations into, nullptr not to sample
+  std::shared_ptr<exec::ExecTime> he_sampled_exec_time;
+  // Number of threads for each CPU library of the backends, -1 to use each backend's own setting
+  int cpu_threads;
+  // CPUs which Eigen and xnnpack worker threads run on, empty for any CPU
+  std::vector<uint32_t> cpu_affinity;
+  // Number of executors compiled for changed input shapes to keep, 0 to run them dynamically
+  int executor_cache_size;
+  // Memory in megabytes of executors compiled for changed input shapes, 0 for no limit
+  int executor_cache_memory;
 
   util::TracingCtx *tracing_ctx; //< Profiling information
 };
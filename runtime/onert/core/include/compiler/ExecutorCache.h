@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  ExecutorCache.h
+ * @brief This file contains ExecutorCache class to keep executors compiled for input shapes
+ */
+
+#ifndef __ONERT_COMPILER_EXECUTOR_CACHE_H__
+#define __ONERT_COMPILER_EXECUTOR_CACHE_H__
+
+#include "compiler/Compiler.h"
+
+#include <functional>
+#include <list>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to keep executors compiled with static input shapes
+ *
+ * When input shapes change, executors otherwise infer shapes of all operations and allocate
+ * tensors dynamically on every run. This class compiles the model with the new input shapes
+ * instead, so that shapes are inferred and memory is planned once at compilation, and keeps the
+ * executors for the shapes which come again.
+ *
+ * Executors are evicted in least recently used order, when there are more than
+ * CompilerOptions::executor_cache_size of them or their memory exceeds
+ * CompilerOptions::executor_cache_memory megabytes. Executors which the model is compiled with
+ * first are always kept, and not counted. Constant data is shared with the model, so only
+ * non-constant tensors are counted as memory of executors.
+ */
+class ExecutorCache
+{
+public:
+  // Returns a new copy of the uncompiled model, of which constant data is shared by all the copies
+  using SubgraphsFactory = std::function<std::shared_ptr<ir::Subgraphs>()>;
+
+public:
+  /**
+   * @brief Construct a new ExecutorCache object
+   *
+   * @param[in] factory   Factory of the model
+   * @param[in] options   Options to compile with
+   * @param[in] executors Executors which the model is compiled with first
+   */
+  ExecutorCache(SubgraphsFactory factory, const CompilerOptions &options,
+                const std::shared_ptr<exec::ExecutorMap> &executors);
+
+public:
+  /**
+   * @brief Get executors compiled with input shapes, which are compiled if not cached
+   *
+   * @param[in] input_shapes Shapes of all inputs of the primary subgraph
+   * @return Executors, which stay valid while they are held even if evicted
+   */
+  std::shared_ptr<exec::ExecutorMap> get(const std::vector<ir::Shape> &input_shapes);
+
+  size_t size() const { return _entries.size(); }
+  // Estimated memory of cached executors in bytes
+  size_t memory() const { return _memory; }
+
+private:
+  struct Entry
+  {
+    std::vector<ir::Shape> input_shapes;
+    size_t memory;
+    std::unique_ptr<util::TracingCtx> tracing_ctx;
+    std::shared_ptr<exec::ExecutorMap> executors;
+  };
+
+  std::shared_ptr<Entry> compile(const std::vector<ir::Shape> &input_shapes);
+  void evict();
+
+private:
+  SubgraphsFactory _factory;
+  CompilerOptions _options;
+  std::vector<ir::Shape> _base_input_shapes;
+  std::shared_ptr<exec::ExecutorMap> _base_executors;
+  // Most recently used first
+  std::list<std::shared_ptr<Entry>> _entries;
+  size_t _memory{0};
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_EXECUTOR_CACHE_H__
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  Rescheduler.h
+ * @brief This file contains Rescheduler class to re-schedule a model with exec times sampled
+ *        while running
+ */
+
+#ifndef __ONERT_COMPILER_RESCHEDULER_H__
+#define __ONERT_COMPILER_RESCHEDULER_H__
+
+#include "compiler/BackendResolver.h"
+#include "compiler/Compiler.h"
+
+#include <functional>
+#include <future>
+#include <mutex>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to re-run HEScheduler in background and recompile a model with a better schedule
+ *
+ * Every CompilerOptions::he_adaptive_interval runs, HEScheduler schedules the model again with
+ * the exec times sampled by executors. A new schedule is compiled only if its estimated makespan
+ * beats the current one by CompilerOptions::he_adaptive_threshold percent in consecutive
+ * re-schedulings, and re-scheduling pauses for a while after that, not to flap between schedules
+ * with noisy exec times.
+ */
+class Rescheduler
+{
+public:
+  // Returns a new copy of the uncompiled model. It is called by the background job as well, so it
+  // must not touch what the caller may be using at the same time.
+  using SubgraphsFactory = std::function<std::shared_ptr<ir::Subgraphs>()>;
+
+  // Number of consecutive re-schedulings which must be better to take a new schedule
+  static constexpr uint32_t REQUIRED_WINS = 2;
+  // Number of re-schedulings to skip after taking a new schedule, so that exec times of operations
+  // moved to other backends are sampled enough
+  static constexpr uint32_t COOLDOWN = 3;
+
+public:
+  /**
+   * @brief Construct a new Rescheduler object
+   *
+   * @param[in] factory Factory of the model
+   * @param[in] options Options which the current executors are compiled with. Their
+   *                    he_exec_time must be set, and the current schedule is taken from it.
+   */
+  Rescheduler(SubgraphsFactory factory, const CompilerOptions &options);
+  ~Rescheduler();
+
+public:
+  /**
+   * @brief Notify that a run has finished, which may start re-scheduling in background
+   */
+  void notifyRun();
+
+  /**
+   * @brief Take executors compiled with a new schedule
+   *
+   * @param[out] tracing_ctx Tracing context of the executors, which must outlive them
+   * @return Executors, or nullptr if there is no new schedule
+   *
+   * @note  If CompilerOptions::trace_filepath is given, executors are traced from here on
+   */
+  std::shared_ptr<exec::ExecutorMap> takeExecutors(std::unique_ptr<util::TracingCtx> &tracing_ctx);
+
+private:
+  using Assignment = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<BackendResolver>>;
+
+  Assignment schedule(const ir::Subgraphs &subgs, const CompilerOptions &options) const;
+  int64_t estimateMakespan(const ir::Subgraphs &subgs, const Assignment &assignment,
+                           const CompilerOptions &options) const;
+  void reschedule();
+
+private:
+  SubgraphsFactory _factory;
+  CompilerOptions _options;
+  // Backends to schedule on, which are taken at construction not to look them up in background
+  std::vector<const backend::Backend *> _backends;
+  // Schedule of the latest executors, which are taken or not
+  Assignment _current;
+  uint32_t _runs{0};
+  // Accessed by the background job only
+  uint32_t _wins{0};
+  uint32_t _cooldown{0};
+  std::future<void> _job;
+
+  std::mutex _mutex;
+  std::unique_ptr<util::TracingCtx> _new_tracing_ctx;
+  std::shared_ptr<exec::ExecutorMap> _new_executors;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_RESCHEDULER_H__
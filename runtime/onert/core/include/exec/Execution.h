@@ -139,6 +139,21 @@ public:
    */
   bool isFinished(void) const;
 
+  /**
+   * @brief   Replace executors with ones compiled from the same model, keeping I/O settings
+   * @note    It must not be called while executing.
+   *          Input shapes changed to the static input shapes of the new executors are no longer
+   *          handled as dynamic.
+   * @param[in] executors Executors to replace with
+   */
+  void setExecutors(const std::shared_ptr<ExecutorMap> &executors);
+
+  /**
+   * @brief   Check if any input shape is changed from the static one of executors
+   * @return  @c true if any input shape is changed, otherwise @c false
+   */
+  bool isInputShapeChanged() const { return !_io_desc.dynamic_input_shapes.empty(); }
+
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
@@ -150,7 +165,7 @@ private:
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
 
 private:
-  const std::shared_ptr<ExecutorMap> _executors;
+  std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
   std::unique_ptr<std::thread> _exec_thread;
   bool finished{false};
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_OP_STATS_H__
+#define __ONERT_EXEC_OP_STATS_H__
+
+#include "ir/Index.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+class Backend;
+} // namespace backend
+
+namespace exec
+{
+
+/**
+ * @brief Histogram of latencies in nanoseconds, which can be updated by many threads without lock
+ *
+ * Latencies are counted in log-linear buckets, 4 for each power of two, so a percentile is off
+ * by 25% at most.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr uint32_t SUB_BUCKET_BITS = 2;
+  static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+  // Below 2^(MAX_BITS + 1) ns (about 36 minutes), and longer ones are counted in the last bucket
+  static constexpr uint32_t MAX_BITS = 40;
+  static constexpr uint32_t NUM_BUCKETS = (MAX_BITS - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+public:
+  LatencyHistogram() { reset(); }
+
+public:
+  void add(uint64_t ns)
+  {
+    _buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(ns, std::memory_order_relaxed);
+    auto max = _max.load(std::memory_order_relaxed);
+    while (ns > max && !_max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+      ;
+  }
+
+  void reset();
+
+  uint64_t count() const { return _count.load(std::memory_order_relaxed); }
+  uint64_t sum() const { return _sum.load(std::memory_order_relaxed); }
+  uint64_t max() const { return _max.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the latency which the given ratio of samples do not exceed
+   *
+   * @param ratio Value in [0, 1], e.g. 0.99 for p99
+   * @return Upper bound of the bucket which the percentile falls into, 0 if there is no sample
+   */
+  uint64_t percentile(double ratio) const;
+
+public:
+  static uint32_t bucketOf(uint64_t ns);
+  static uint64_t bucketUpperBound(uint32_t bucket);
+
+private:
+  std::array<std::atomic<uint64_t>, NUM_BUCKETS> _buckets;
+  std::atomic<uint64_t> _count;
+  std::atomic<uint64_t> _sum;
+  std::atomic<uint64_t> _max;
+};
+
+/**
+ * @brief Execution statistics of operations and subgraphs gathered from executors
+ *
+ * Executors compiled from the same model can share an OpStats, then statistics of the same
+ * operation are accumulated into one entry.
+ */
+class OpStats
+{
+public:
+  struct Entry
+  {
+    ir::SubgraphIndex subg_index;
+    ir::OperationIndex op_index; // Undefined for the statistics of the whole subgraph
+    std::string name;
+    uint64_t bytes; // Bytes of inputs and outputs touched by an invocation
+
+    // Backend which the operation ran on last, nullptr for subgraph
+    std::atomic<const backend::Backend *> backend{nullptr};
+    LatencyHistogram latency;
+  };
+
+public:
+  /**
+   * @brief Get an entry, which is created if it does not exist
+   *
+   * @note  Entries are never destroyed until this OpStats is destroyed, so that executors can
+   *        keep and update them without lock
+   */
+  Entry &entry(ir::SubgraphIndex subg_index, ir::OperationIndex op_index, const std::string &name,
+               uint64_t bytes);
+
+  /**
+   * @brief Get all entries ordered by subgraph index, then operation index
+   *
+   * The entry of a subgraph comes after its operations.
+   */
+  std::vector<const Entry *> entries() const;
+
+  /**
+   * @brief Clear statistics of all entries
+   */
+  void reset();
+
+private:
+  mutable std::mutex _mutex;
+  std::map<std::pair<uint32_t, uint32_t>, std::unique_ptr<Entry>> _entries;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_OP_STATS_H__
@@ -129,6 +129,13 @@ public:
    */
   std::shared_ptr<Graph> primary() const { return _subgraphs.at(SubgraphIndex{0}); }
 
+  /**
+   * @brief Copy subgraphs to be compiled apart from these ones
+   *
+   * @return Copied subgraphs, of which constant operands share data with these ones
+   */
+  std::shared_ptr<Subgraphs> clone() const;
+
 private:
   std::unordered_map<SubgraphIndex, std::shared_ptr<Graph>> _subgraphs;
 };
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_CPU_AFFINITY_H__
+#define __ONERT_UTIL_CPU_AFFINITY_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief  Parse a CPU list such as "0-3,6"
+ * @return CPU ids in ascending order without duplicates, empty for an empty string
+ * @throw  std::invalid_argument if the list is malformed
+ */
+std::vector<uint32_t> parseCpuList(const std::string &str);
+
+/**
+ * @brief  Split CPUs into the given number of parts in order, as evenly as possible
+ * @return Parts of the CPUs, each of which is all the CPUs if there are fewer CPUs than parts
+ */
+std::vector<std::vector<uint32_t>> splitCpuList(const std::vector<uint32_t> &cpus, size_t parts);
+
+/**
+ * @brief  Bind the calling thread to the CPUs
+ * @return true if the binding is done or there is nothing to bind
+ */
+bool setThreadAffinity(const std::vector<uint32_t> &cpus);
+
+/**
+ * @brief Bind the calling thread to the CPUs while the object lives
+ *
+ * Threads created in the scope inherit the binding.
+ */
+class ScopedThreadAffinity
+{
+public:
+  ScopedThreadAffinity(const std::vector<uint32_t> &cpus);
+  ~ScopedThreadAffinity();
+
+  ScopedThreadAffinity(const ScopedThreadAffinity &) = delete;
+  ScopedThreadAffinity &operator=(const ScopedThreadAffinity &) = delete;
+
+private:
+  std::vector<uint32_t> _prev_cpus;
+  bool _changed;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_CPU_AFFINITY_H__
@@ -25,7 +25,7 @@ namespace backend
 namespace basic
 {
 
-Allocator::Allocator(uint32_t capacity)
+Allocator::Allocator(uint32_t capacity) : _capacity{capacity}
 {
   _base = std::make_unique<uint8_t[]>(capacity);
 
@@ -33,6 +33,13 @@ Allocator::Allocator(uint32_t capacity)
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
+Allocator::Allocator(std::unique_ptr<uint8_t[]> base, uint32_t capacity)
+  : _base{std::move(base)}, _capacity{capacity}
+{
+  VERBOSE(ALLOC) << "reused capacity: " << capacity << std::endl;
+  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
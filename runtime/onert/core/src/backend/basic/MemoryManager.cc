@@ -16,6 +16,7 @@
 
 #include <backend/basic/MemoryManager.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include "MemoryPlannerFactory.h"
@@ -51,12 +52,12 @@ basic::IMemoryPlanner *MemoryManager::createMemoryPlanner(const std::string plan
   return basic::MemoryPlannerFactory::get().create(planner_id);
 }
 
-void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+void MemoryManager::claimPlan(const PlanIndex &ind, uint32_t size)
 {
   _mem_planner->claim(ind, size);
 }
 
-void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->release(ind); }
+void MemoryManager::releasePlan(const PlanIndex &ind) { _mem_planner->release(ind); }
 
 void MemoryManager::allocate(void)
 {
@@ -64,7 +65,7 @@ void MemoryManager::allocate(void)
   assert(_mem_alloc->base());
 }
 
-uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
+uint8_t *MemoryManager::getBuffer(const PlanIndex &ind) const
 {
   assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
   const auto &mem_blk = _mem_planner->memory_plans().at(ind);
@@ -74,26 +75,53 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   auto find = _mem_alloc_map.find(tensor);
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  _stats.num_allocations++;
+  _stats.allocated_bytes += capacity;
+
+  std::shared_ptr<basic::Allocator> alloc;
+  // Best fit in the pool, which does not waste more than a half of the buffer
+  auto pooled = _pool.lower_bound(capacity);
+  if (pooled != _pool.end() && pooled->first <= 2ull * capacity)
+  {
+    alloc = std::make_shared<basic::Allocator>(std::move(pooled->second), pooled->first);
+    _pooled_bytes -= pooled->first;
+    _pool.erase(pooled);
+  }
+  else
+  {
+    _stats.num_heap_allocations++;
+    alloc = std::make_shared<basic::Allocator>(capacity);
+  }
+
+  _in_use_bytes += alloc->capacity();
+  _peak_in_use_bytes = std::max(_peak_in_use_bytes, _in_use_bytes);
+
+  _mem_alloc_map[tensor] = alloc;
+  return alloc;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   auto find = _mem_alloc_map.find(tensor);
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
+  recycle(*find->second);     // explicitly take memory from the tensor
   _mem_alloc_map.erase(find); // remove tensor and alloc
 }
 
 void DynamicMemoryManager::deallocate(void)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   for (auto &mem_alloc : _mem_alloc_map)
   {
     // Release memory buffer of mem_alloc
@@ -101,6 +129,38 @@ void DynamicMemoryManager::deallocate(void)
   }
 
   _mem_alloc_map.clear();
+  _pool.clear();
+  _pooled_bytes = 0;
+  _in_use_bytes = 0;
+}
+
+void DynamicMemoryManager::recycle(basic::Allocator &alloc)
+{
+  const uint32_t capacity = alloc.capacity();
+  assert(_in_use_bytes >= capacity);
+  _in_use_bytes -= capacity;
+
+  auto buffer = alloc.take();
+  if (buffer == nullptr)
+    return; // Released by the tensor already
+
+  // Keep the pool within the peak usage, dropping smaller buffers first
+  while (!_pool.empty() && _pooled_bytes + capacity > _peak_in_use_bytes)
+  {
+    _pooled_bytes -= _pool.begin()->first;
+    _pool.erase(_pool.begin());
+  }
+  if (_pooled_bytes + capacity > _peak_in_use_bytes)
+    return;
+
+  _pool.emplace(capacity, std::move(buffer));
+  _pooled_bytes += capacity;
+}
+
+DynamicMemoryStats DynamicMemoryManager::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
 }
 
 } // namespace basic
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/Tensor.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+using namespace onert;
+using namespace backend::basic;
+
+std::unique_ptr<Tensor> createTensor(DynamicMemoryManager *mgr)
+{
+  auto info = ir::OperandInfo::createStaticInfo(ir::Shape{1}, ir::TypeInfo{ir::DataType::FLOAT32});
+  return std::make_unique<Tensor>(info, ir::Layout::NHWC, mgr);
+}
+
+TEST(DynamicMemoryManager, reuse_deallocated_buffer)
+{
+  DynamicMemoryManager mgr;
+  auto t1 = createTensor(&mgr);
+  auto t2 = createTensor(&mgr);
+
+  auto base = mgr.allocate(t1.get(), 1024)->base();
+  mgr.deallocate(t1.get());
+
+  // Smaller one reuses the buffer
+  ASSERT_EQ(mgr.allocate(t2.get(), 1000)->base(), base);
+  mgr.deallocate(t2.get());
+  ASSERT_EQ(mgr.allocate(t1.get(), 1024)->base(), base);
+
+  const auto stats = mgr.stats();
+  ASSERT_EQ(stats.num_allocations, 3);
+  ASSERT_EQ(stats.allocated_bytes, 1024 + 1000 + 1024);
+  ASSERT_EQ(stats.num_heap_allocations, 1);
+}
+
+TEST(DynamicMemoryManager, neg_allocate_twice)
+{
+  DynamicMemoryManager mgr;
+  auto t = createTensor(&mgr);
+
+  mgr.allocate(t.get(), 16);
+  EXPECT_ANY_THROW(mgr.allocate(t.get(), 16));
+}
+
+TEST(DynamicMemoryManager, neg_deallocate_unknown)
+{
+  DynamicMemoryManager mgr;
+  auto t = createTensor(&mgr);
+
+  EXPECT_ANY_THROW(mgr.deallocate(t.get()));
+
+  mgr.allocate(t.get(), 16);
+  mgr.deallocate(t.get());
+  EXPECT_ANY_THROW(mgr.deallocate(t.get()));
+}
+
+} // namespace
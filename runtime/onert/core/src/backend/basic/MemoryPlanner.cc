@@ -16,7 +16,12 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <limits>
+#include <numeric>
 
 namespace onert
 {
@@ -25,7 +30,7 @@ namespace backend
 namespace basic
 {
 
-void BumpPlanner::claim(const ir::OperandIndex &ind, size_t size)
+void BumpPlanner::claim(const PlanIndex &ind, size_t size)
 {
   Block blk{_capacity, size};
   _mem_plans[ind] = blk;
@@ -34,7 +39,7 @@ void BumpPlanner::claim(const ir::OperandIndex &ind, size_t size)
   VERBOSE(BP_PLANNER) << "CLAIM(" << ind << "): " << blk.offset << ", " << blk.size << std::endl;
 }
 
-void BumpPlanner::release(const ir::OperandIndex &ind)
+void BumpPlanner::release(const PlanIndex &ind)
 {
   VERBOSE(BP_PLANNER) << "RELEASE(" << ind << "): "
                       << "NOTHING does" << std::endl;
@@ -43,7 +48,7 @@ void BumpPlanner::release(const ir::OperandIndex &ind)
 // There are some assumptions for claiming memory(== making a reservation for memory).
 // 1. About _claim_table(std::map).
 //   - The table's data structure is std::map so that it always sorts
-//     value(OperandIndex) by key(base_offset).
+//     value(PlanIndex) by key(base_offset).
 //   - This claim() inserts key/value into _claim_table and the release() removes the key/value from
 //     _claim_table.
 //   - _claim_table shows the memory status at a certain point in time. Therefore,
@@ -54,7 +59,7 @@ void BumpPlanner::release(const ir::OperandIndex &ind)
 //       point in time, it means the place at the offset can be claimed.
 // 2. In the loop for _claim_table, we can assume the current claim_base_offset value is bigger than
 //    the previous claim_base_offset.
-void FirstFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
+void FirstFitPlanner::claim(const PlanIndex &ind, size_t size)
 {
   // Find the right position for claiming
   uint32_t next_offset = 0;
@@ -85,19 +90,18 @@ void FirstFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
   }
 }
 
-void FirstFitPlanner::release(const ir::OperandIndex &ind)
+void FirstFitPlanner::release(const PlanIndex &ind)
 {
   for (auto it = _claim_table.cbegin(); it != _claim_table.cend(); ++it)
   {
     if (it->second == ind)
     {
       uint32_t offset = it->first;
-      uint32_t index = ind.value();
       uint32_t size = _mem_plans[ind].size;
 
       _claim_table.erase(it);
 
-      VERBOSE(FF_PLANNER) << "release(" << index << "): [+" << offset << ", " << size << "sz]"
+      VERBOSE(FF_PLANNER) << "release(" << ind << "): [+" << offset << ", " << size << "sz]"
                           << std::endl;
       return;
     }
@@ -112,7 +116,7 @@ WICPlanner::WICPlanner()
   // DO NOTHING
 }
 
-void WICPlanner::claim(const ir::OperandIndex &ind, size_t size)
+void WICPlanner::claim(const PlanIndex &ind, size_t size)
 {
   _operands.emplace(size, ind);
   _interference_graph[ind].insert(_interference_graph[ind].end(), _live_operands.cbegin(),
@@ -126,7 +130,7 @@ void WICPlanner::claim(const ir::OperandIndex &ind, size_t size)
   VERBOSE(WIC_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
 }
 
-void WICPlanner::release(const ir::OperandIndex &ind)
+void WICPlanner::release(const PlanIndex &ind)
 {
   _live_operands.erase(ind);
   VERBOSE(WIC_PLANNER) << "release(" << ind << ")" << std::endl;
@@ -146,7 +150,7 @@ void WICPlanner::buildMemoryPlans()
   for (const auto &operand : _operands)
   {
     uint32_t size = operand.first;
-    const ir::OperandIndex &ind = operand.second;
+    const PlanIndex &ind = operand.second;
     VERBOSE(WIC_PLANNER) << "build_plan(" << ind << "): [" << size << "sz]" << std::endl;
 
     uint32_t next_offset = 0;
@@ -203,6 +207,233 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+void GreedyBreadthPlanner::claim(const PlanIndex &ind, size_t size)
+{
+  assert(_operand_to_id.find(ind) == _operand_to_id.end());
+  _operand_to_id[ind] = _operands.size();
+  _operands.emplace_back(ind);
+  _lifetimes.push_back({size, _time++, std::numeric_limits<uint32_t>::max()});
+
+  VERBOSE(GB_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
+}
+
+void GreedyBreadthPlanner::release(const PlanIndex &ind)
+{
+  auto it = _operand_to_id.find(ind);
+  if (it != _operand_to_id.end())
+    _lifetimes[it->second].last = _time++;
+
+  VERBOSE(GB_PLANNER) << "release(" << ind << ")" << std::endl;
+}
+
+// Assign offsets to operands in the given order. Each operand is placed in a gap between the
+// operands placed already whose lifetimes overlap with it: the lowest one (first fit) or the
+// smallest one (best fit). Returns the capacity.
+uint32_t GreedyBreadthPlanner::assign(const std::vector<size_t> &order, bool best_fit,
+                                      std::vector<uint32_t> &offsets) const
+{
+  const auto num_operands = _lifetimes.size();
+  std::vector<bool> placed(num_operands, false);
+  uint32_t capacity = 0;
+  for (const auto id : order)
+  {
+    const auto &lifetime = _lifetimes[id];
+
+    std::vector<std::pair<uint32_t, uint32_t>> interfered_plans; // (offset, end)
+    for (size_t other = 0; other < num_operands; ++other)
+    {
+      const auto &other_lifetime = _lifetimes[other];
+      if (placed[other] && other_lifetime.first <= lifetime.last &&
+          lifetime.first <= other_lifetime.last)
+        interfered_plans.emplace_back(offsets[other], offsets[other] + other_lifetime.size);
+    }
+    std::sort(interfered_plans.begin(), interfered_plans.end());
+
+    uint32_t next_offset = 0;
+    uint32_t best_offset = std::numeric_limits<uint32_t>::max();
+    uint32_t best_gap = std::numeric_limits<uint32_t>::max();
+    for (const auto &interfered_plan : interfered_plans)
+    {
+      if (next_offset + lifetime.size <= interfered_plan.first)
+      {
+        const uint32_t gap = interfered_plan.first - next_offset;
+        if (!best_fit)
+        {
+          best_offset = next_offset;
+          break;
+        }
+        if (gap < best_gap)
+        {
+          best_gap = gap;
+          best_offset = next_offset;
+        }
+      }
+      next_offset = std::max(next_offset, interfered_plan.second);
+    }
+    if (best_offset == std::numeric_limits<uint32_t>::max())
+      best_offset = next_offset;
+
+    offsets[id] = best_offset;
+    placed[id] = true;
+    capacity = std::max<uint32_t>(capacity, best_offset + lifetime.size);
+  }
+  return capacity;
+}
+
+// Local search: move operands down to the lowest offset where they fit, starting from the
+// operands ending at the highest address, until no operand can be moved. Returns the capacity.
+uint32_t GreedyBreadthPlanner::compact(std::vector<uint32_t> &offsets) const
+{
+  const auto num_operands = _lifetimes.size();
+  std::vector<size_t> order(num_operands);
+  std::iota(order.begin(), order.end(), 0);
+
+  bool moved = true;
+  for (int pass = 0; moved && pass < 8; ++pass)
+  {
+    moved = false;
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+      return offsets[lhs] + _lifetimes[lhs].size > offsets[rhs] + _lifetimes[rhs].size;
+    });
+
+    for (const auto id : order)
+    {
+      const auto &lifetime = _lifetimes[id];
+
+      std::vector<std::pair<uint32_t, uint32_t>> interfered_plans; // (offset, end)
+      for (size_t other = 0; other < num_operands; ++other)
+      {
+        const auto &other_lifetime = _lifetimes[other];
+        if (other != id && other_lifetime.first <= lifetime.last &&
+            lifetime.first <= other_lifetime.last)
+          interfered_plans.emplace_back(offsets[other], offsets[other] + other_lifetime.size);
+      }
+      std::sort(interfered_plans.begin(), interfered_plans.end());
+
+      uint32_t next_offset = 0;
+      for (const auto &interfered_plan : interfered_plans)
+      {
+        if (next_offset + lifetime.size <= interfered_plan.first || next_offset >= offsets[id])
+          break;
+        next_offset = std::max(next_offset, interfered_plan.second);
+      }
+
+      if (next_offset < offsets[id])
+      {
+        offsets[id] = next_offset;
+        moved = true;
+      }
+    }
+  }
+
+  uint32_t capacity = 0;
+  for (size_t id = 0; id < num_operands; ++id)
+    capacity = std::max<uint32_t>(capacity, offsets[id] + _lifetimes[id].size);
+  return capacity;
+}
+
+// Operands in descending order of size, which is the order of WICPlanner
+std::vector<size_t> GreedyBreadthPlanner::orderBySize() const
+{
+  std::vector<size_t> order(_lifetimes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return _lifetimes[lhs].size > _lifetimes[rhs].size;
+  });
+  return order;
+}
+
+// Operands in the order of greedy by breadth: visit the points of time (claims) in descending
+// order of the total size of live operands, and take the live operands at each point in
+// descending order of size
+std::vector<size_t> GreedyBreadthPlanner::orderByBreadth() const
+{
+  const auto num_operands = _lifetimes.size();
+  const auto by_size = orderBySize();
+
+  std::vector<std::pair<uint64_t, uint32_t>> breadths; // (breadth, time)
+  for (const auto &lifetime : _lifetimes)
+  {
+    const auto time = lifetime.first;
+    uint64_t breadth = 0;
+    for (const auto &other_lifetime : _lifetimes)
+    {
+      if (other_lifetime.first <= time && time <= other_lifetime.last)
+        breadth += other_lifetime.size;
+    }
+    breadths.emplace_back(breadth, time);
+  }
+  std::stable_sort(breadths.begin(), breadths.end(),
+                   [](const std::pair<uint64_t, uint32_t> &lhs,
+                      const std::pair<uint64_t, uint32_t> &rhs) { return lhs.first > rhs.first; });
+
+  std::vector<size_t> order;
+  std::vector<bool> ordered(num_operands, false);
+  for (const auto &breadth : breadths)
+  {
+    const auto time = breadth.second;
+    for (const auto id : by_size)
+    {
+      const auto &lifetime = _lifetimes[id];
+      if (!ordered[id] && lifetime.first <= time && time <= lifetime.last)
+      {
+        order.emplace_back(id);
+        ordered[id] = true;
+      }
+    }
+  }
+  assert(order.size() == num_operands);
+  return order;
+}
+
+void GreedyBreadthPlanner::buildMemoryPlans()
+{
+  const auto begin = std::chrono::steady_clock::now();
+
+  const auto by_size = orderBySize();
+  const auto by_breadth = orderByBreadth();
+  const std::vector<std::pair<const std::vector<size_t> *, bool>> candidates = {
+    {&by_size, false}, {&by_size, true}, {&by_breadth, true}};
+
+  std::vector<uint32_t> best_offsets;
+  _capacity = std::numeric_limits<uint32_t>::max();
+  for (const auto &candidate : candidates)
+  {
+    std::vector<uint32_t> offsets(_lifetimes.size(), 0);
+    assign(*candidate.first, candidate.second, offsets);
+    const auto capacity = compact(offsets);
+    if (capacity < _capacity)
+    {
+      _capacity = capacity;
+      best_offsets = std::move(offsets);
+    }
+  }
+  if (_lifetimes.empty())
+    _capacity = 0;
+
+  for (size_t id = 0; id < _operands.size(); ++id)
+  {
+    _mem_plans[_operands[id]] = {best_offsets[id], _lifetimes[id].size};
+    VERBOSE(GB_PLANNER) << "alloc(" << _operands[id] << "): [+" << best_offsets[id] << ", "
+                        << _lifetimes[id].size << "sz]" << std::endl;
+  }
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - begin);
+  VERBOSE(GB_PLANNER) << "capacity: " << _capacity << " bytes for " << _operands.size()
+                      << " operands, planning time: " << elapsed.count() << " us" << std::endl;
+
+  _initialized = true;
+  _operand_to_id.clear();
+}
+
+GreedyBreadthPlanner::MemoryPlans &GreedyBreadthPlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
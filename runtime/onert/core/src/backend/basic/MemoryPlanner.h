@@ -29,7 +29,6 @@
 
 #include "backend/basic/Allocator.h"
 #include "backend/basic/IMemoryPlanner.h"
-#include "ir/OperandIndexMap.h"
 
 namespace onert
 {
@@ -49,12 +48,12 @@ public:
    * @param[in] index The operand index
    * @param[in] size The size of the memory
    */
-  void claim(const ir::OperandIndex &, size_t) override;
+  void claim(const PlanIndex &, size_t) override;
   /**
    * @brief Release memory for operand by bump way
    * @param[in] index The operand index
    */
-  void release(const ir::OperandIndex &) override;
+  void release(const PlanIndex &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -82,12 +81,12 @@ public:
    * @param[in] index The operand index
    * @param[in] size The size of the memory
    */
-  void claim(const ir::OperandIndex &, size_t) override;
+  void claim(const PlanIndex &, size_t) override;
   /**
    * @brief Release memory for operand by firstfit way
    * @param[in] index The operand index
    */
-  void release(const ir::OperandIndex &) override;
+  void release(const PlanIndex &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -103,7 +102,7 @@ private:
   uint32_t _capacity = 0;
   MemoryPlans _mem_plans;
   // Use std::map because claim() assumes that _claim_table is sorted by uint32_t(base_offset)
-  std::map<uint32_t, ir::OperandIndex> _claim_table;
+  std::map<uint32_t, PlanIndex> _claim_table;
 };
 
 /**
@@ -119,12 +118,12 @@ public:
    * @param[in] index The operand index
    * @param[in] size The size of the memory
    */
-  void claim(const ir::OperandIndex &, size_t) override;
+  void claim(const PlanIndex &, size_t) override;
   /**
    * @brief Release memory for operand by WIC algorithm
    * @param[in] index The operand index
    */
-  void release(const ir::OperandIndex &) override;
+  void release(const PlanIndex &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -147,10 +146,73 @@ private:
   bool _initialized;
   uint32_t _capacity;
   MemoryPlans _mem_plans;
-  std::unordered_set<ir::OperandIndex> _live_operands;
-  ir::OperandIndexMap<std::vector<ir::OperandIndex>> _interference_graph;
+  std::unordered_set<PlanIndex> _live_operands;
+  PlanIndexMap<std::vector<PlanIndex>> _interference_graph;
   // Sort operands by descending order of size
-  std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
+  std::multimap<uint32_t, PlanIndex, std::greater<uint32_t>> _operands;
+};
+
+/**
+ * @brief Class to plan memory by greedy by breadth algorithm with local search
+ *
+ * This planner collects lifetimes of all operands first, and assigns offsets at once when the
+ * plans are requested. It tries several greedy assignments and refines them by moving each
+ * operand down as far as possible, then takes the one with the smallest capacity. One of the
+ * assignments is the one of WICPlanner, so the capacity is never bigger than WICPlanner's.
+ */
+class GreedyBreadthPlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Claim memory for operand, which starts the lifetime of the operand
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const PlanIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand, which ends the lifetime of the operand
+   * @param[in] index The operand index
+   */
+  void release(const PlanIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+
+private:
+  struct Lifetime
+  {
+    size_t size;
+    // Times of claim and release, both inclusive
+    uint32_t first;
+    uint32_t last;
+  };
+
+  void buildMemoryPlans();
+  uint32_t assign(const std::vector<size_t> &order, bool best_fit,
+                  std::vector<uint32_t> &offsets) const;
+  uint32_t compact(std::vector<uint32_t> &offsets) const;
+  std::vector<size_t> orderBySize() const;
+  std::vector<size_t> orderByBreadth() const;
+
+  bool _initialized = false;
+  uint32_t _capacity = 0;
+  MemoryPlans _mem_plans;
+  uint32_t _time = 0;
+  std::vector<PlanIndex> _operands;
+  std::vector<Lifetime> _lifetimes;
+  PlanIndexMap<size_t> _operand_to_id;
 };
 
 } // namespace basic
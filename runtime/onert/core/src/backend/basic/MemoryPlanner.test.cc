@@ -19,6 +19,10 @@
 #include "MemoryPlanner.h"
 #include "ir/Index.h"
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 TEST(Allocator, allocate_test)
 {
   ::onert::backend::basic::Allocator allocator(1024);
@@ -191,3 +195,121 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(GreedyBreadthPlanner, claim_release_test)
+{
+  ::onert::backend::basic::GreedyBreadthPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  auto capacity = [&planner](uint32_t expected_capacity) {
+    auto actual_capacity = planner.capacity();
+    ASSERT_EQ(actual_capacity, expected_capacity);
+  };
+
+  claim(0, 20);
+  claim(1, 5);
+  release(0);
+  claim(2, 10);
+  release(1);
+  claim(3, 10);
+  release(2);
+  claim(4, 10);
+  release(3);
+  claim(5, 20);
+  release(4);
+  claim(6, 20);
+  release(5);
+  release(7);
+
+  // VERIFY 0 - 0
+  verify(0, 20, 0);
+
+  // VERIFY 1 - 20
+  verify(1, 5, 20);
+
+  // VERIFY 2 - 0
+  verify(2, 10, 0);
+
+  // VERIFY 3 - 10
+  verify(3, 10, 10);
+
+  // VERIFY 4 - 20
+  verify(4, 10, 20);
+
+  // VERIFY 5 - 0
+  verify(5, 20, 0);
+
+  // VERIFY 6 - 20
+  verify(6, 20, 20);
+
+  // CAPACITY - 40
+  capacity(40);
+}
+
+TEST(GreedyBreadthPlanner, not_bigger_than_wic)
+{
+  std::mt19937 gen(0);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    ::onert::backend::basic::GreedyBreadthPlanner gb_planner;
+    ::onert::backend::basic::WICPlanner wic_planner;
+
+    // Operands of random sizes, each of which is used by a few next operations
+    const uint32_t num_operands = 100;
+    std::vector<std::vector<uint32_t>> releases(num_operands + 8);
+    for (uint32_t index = 0; index < num_operands; ++index)
+    {
+      for (auto ind : releases[index])
+      {
+        gb_planner.release(onert::ir::OperandIndex{ind});
+        wic_planner.release(onert::ir::OperandIndex{ind});
+      }
+      const size_t size = std::uniform_int_distribution<size_t>(1, 1024)(gen);
+      gb_planner.claim(onert::ir::OperandIndex{index}, size);
+      wic_planner.claim(onert::ir::OperandIndex{index}, size);
+      releases[index + std::uniform_int_distribution<uint32_t>(1, 8)(gen)].push_back(index);
+    }
+
+    ASSERT_LE(gb_planner.capacity(), wic_planner.capacity());
+
+    // No overlap between operands alive at the same time
+    auto &plans = gb_planner.memory_plans();
+    for (uint32_t time = 0; time < num_operands; ++time)
+    {
+      std::vector<std::pair<uint32_t, size_t>> blocks;
+      for (uint32_t index = 0; index <= time; ++index)
+      {
+        bool released = false;
+        for (uint32_t t = index + 1; t <= time; ++t)
+          for (auto ind : releases[t])
+            released |= (ind == index);
+        if (!released)
+        {
+          const auto &blk = plans.at(onert::ir::OperandIndex{index});
+          blocks.emplace_back(blk.offset, blk.size);
+        }
+      }
+      std::sort(blocks.begin(), blocks.end());
+      for (size_t i = 1; i < blocks.size(); ++i)
+        ASSERT_LE(blocks[i - 1].first + blocks[i - 1].second, blocks[i].first);
+      for (const auto &blk : blocks)
+        ASSERT_LE(blk.first + blk.second, gb_planner.capacity());
+    }
+  }
+}
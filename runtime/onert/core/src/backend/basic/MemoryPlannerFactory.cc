@@ -45,6 +45,10 @@ IMemoryPlanner *MemoryPlannerFactory::create(const std::string &key)
   {
     return new WICPlanner;
   }
+  else if (key == "GreedyBreadth")
+  {
+    return new GreedyBreadthPlanner;
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
@@ -52,6 +52,16 @@ void StaticTensorManager::allocateNonconsts(void)
         << "TENSOR " << ind << " : " << static_cast<void *>(buffer) << std::endl;
     }
   }
+
+  for (auto &pair : _scratches)
+  {
+    const auto &ind = pair.first;
+    auto *buffer = _nonconst_mgr->getBuffer(PlanIndex::scratch(ind));
+    pair.second->setBuffer(buffer);
+
+    VERBOSE(CPU_StaticTensorManager) << "SCRATCH " << ind << " : " << static_cast<void *>(buffer)
+                                     << " (" << pair.second->size() << " bytes)" << std::endl;
+  }
 }
 
 void StaticTensorManager::deallocateNonconsts(void) { _nonconst_mgr->deallocate(); }
@@ -97,6 +107,37 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
     _nonconst_mgr->releasePlan(ind);
 }
 
+ScratchBuffer *StaticTensorManager::buildScratch(const ir::OperationIndex &ind, size_t size)
+{
+  assert(!hasScratch(ind));
+  assert(size > 0);
+  auto scratch = std::make_unique<ScratchBuffer>(size);
+  auto ret = scratch.get();
+  _scratches.emplace(ind, std::move(scratch));
+  return ret;
+}
+
+bool StaticTensorManager::hasScratch(const ir::OperationIndex &ind) const
+{
+  return _scratches.find(ind) != _scratches.end();
+}
+
+void StaticTensorManager::claimScratchPlan(const ir::OperationIndex &ind)
+{
+  if (!hasScratch(ind))
+    return;
+
+  _nonconst_mgr->claimPlan(PlanIndex::scratch(ind), _scratches.at(ind)->size());
+}
+
+void StaticTensorManager::releaseScratchPlan(const ir::OperationIndex &ind)
+{
+  if (!hasScratch(ind))
+    return;
+
+  _nonconst_mgr->releasePlan(PlanIndex::scratch(ind));
+}
+
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
 {
   for (const auto &it : _tensors->native_tensors())
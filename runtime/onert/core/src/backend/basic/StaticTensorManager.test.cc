@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/TensorBuilder.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace onert;
+using namespace backend::basic;
+
+TEST(StaticTensorManager, scratch)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+  TensorBuilder builder{reg};
+
+  const ir::OperandIndex ind{0};
+  auto info = ir::OperandInfo::createStaticInfo(ir::Shape{16}, ir::TypeInfo{ir::DataType::FLOAT32});
+  builder.registerTensorInfo(ind, info, ir::Layout::NHWC);
+
+  auto scratch0 = builder.registerScratch(ir::OperationIndex{0}, 256);
+  auto scratch1 = builder.registerScratch(ir::OperationIndex{1}, 256);
+  ASSERT_EQ(scratch0->size(), 256);
+  ASSERT_EQ(scratch0->buffer(), nullptr);
+
+  // op0 defines the tensor and op1 uses it
+  builder.notifyFirstUse(ind);
+  builder.notifyScratchFirstUse(ir::OperationIndex{0});
+  builder.notifyScratchLastUse(ir::OperationIndex{0});
+  builder.notifyScratchFirstUse(ir::OperationIndex{1});
+  builder.notifyLastUse(ind);
+  builder.notifyScratchLastUse(ir::OperationIndex{1});
+
+  // Operation without scratch is ignored
+  builder.notifyScratchFirstUse(ir::OperationIndex{2});
+  builder.notifyScratchLastUse(ir::OperationIndex{2});
+
+  builder.allocate();
+
+  auto tensor_buffer = reg->getNativeTensor(ind)->buffer();
+  ASSERT_NE(scratch0->buffer(), nullptr);
+  ASSERT_NE(scratch1->buffer(), nullptr);
+
+  // Scratch buffers of different operations never live together
+  ASSERT_EQ(scratch0->buffer(), scratch1->buffer());
+
+  // Scratch buffer does not overlap with the tensor that lives together
+  ASSERT_TRUE(tensor_buffer + info.total_size() <= scratch0->buffer() ||
+              scratch0->buffer() + scratch0->size() <= tensor_buffer);
+}
+
+} // namespace
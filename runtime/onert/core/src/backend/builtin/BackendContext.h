@@ -38,7 +38,7 @@ public:
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
       tensor_builder{tensor_builder}, kernel_gen{kernel_gen},
-      _external_context(std::make_shared<ExternalContext>())
+      _external_context(std::make_shared<ExternalContext>(_data.cpu_threads, _data.cpu_affinity))
   {
   }
 
@@ -18,6 +18,9 @@
 #define __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/CpuAffinity.h>
+
+#include <cker/ruy/RuySupport.h>
 
 #include <ruy/context.h>
 #include <ruy/context_get_ctx.h>
@@ -38,10 +41,22 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(std::make_unique<ruy::Context>())
+  /**
+   * @param[in] num_threads  Number of threads for ruy, -1 to use RUY_THREADS
+   * @param[in] cpu_affinity CPUs which ruy threads run on, empty for any CPU
+   */
+  ExternalContext(int num_threads = -1, const std::vector<uint32_t> &cpu_affinity = {})
+    : _ruy_context(std::make_unique<ruy::Context>())
   {
-    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    setMaxNumThreads(num_threads > 0
+                       ? num_threads
+                       : onert::util::getConfigInt(onert::util::config::RUY_THREADS));
     initPerThreadState();
+    if (!cpu_affinity.empty())
+    {
+      onert::util::ScopedThreadAffinity affinity{cpu_affinity};
+      nnfw::cker::ruy_support::CreateWorkerThreads(_ruy_context.get());
+    }
   }
 
   void setMaxNumThreads(int max_num_threads)
@@ -88,6 +88,21 @@ bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
 }
 
+basic::ScratchBuffer *TensorBuilder::registerScratch(const ir::OperationIndex &ind, size_t size)
+{
+  return _static_tensor_mgr->buildScratch(ind, size);
+}
+
+void TensorBuilder::notifyScratchFirstUse(const ir::OperationIndex &ind)
+{
+  _static_tensor_mgr->claimScratchPlan(ind);
+}
+
+void TensorBuilder::notifyScratchLastUse(const ir::OperationIndex &ind)
+{
+  _static_tensor_mgr->releaseScratchPlan(ind);
+}
+
 void TensorBuilder::allocate(void) { _static_tensor_mgr->allocateNonconsts(); }
 
 DynamicTensorManager *TensorBuilder::dynamicTensorManager(void)
@@ -53,6 +53,17 @@ public:
 
   bool isRegistered(const ir::OperandIndex &) const;
 
+  /**
+   * @brief     Register a scratch buffer that lives while an operation runs
+   * @param[in] ind  Operation index
+   * @param[in] size Size of the scratch buffer in bytes
+   * @return    ScratchBuffer whose buffer becomes valid after allocate()
+   */
+  basic::ScratchBuffer *registerScratch(const ir::OperationIndex &ind, size_t size);
+
+  void notifyScratchFirstUse(const ir::OperationIndex &);
+  void notifyScratchLastUse(const ir::OperationIndex &);
+
   void allocate(void);
 
   DynamicTensorManager *dynamicTensorManager(void);
@@ -64,7 +64,8 @@ void BackendManager::loadBuiltinBackend()
 
 void BackendManager::loadBackend(const std::string &backend)
 {
-  if (get(backend) != nullptr)
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_gen_map.find(backend) != _gen_map.end())
   {
     return;
   }
@@ -134,6 +135,7 @@ void BackendManager::loadBackend(const std::string &backend)
 
 backend::Backend *BackendManager::get(const std::string &key)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   if (_gen_map.find(key) != _gen_map.end())
   {
     return _gen_map.at(key).get();
@@ -144,6 +146,7 @@ backend::Backend *BackendManager::get(const std::string &key)
 
 const backend::Backend *BackendManager::get(const std::string &key) const
 {
+  std::lock_guard<std::mutex> lock{_mutex};
   if (_gen_map.find(key) != _gen_map.end())
   {
     return _gen_map.at(key).get();
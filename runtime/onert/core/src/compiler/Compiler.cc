@@ -36,10 +36,13 @@
 #include "compiler/Linear.h"
 #include "interp/InterpExecutor.h"
 #include "util/ConfigSource.h"
+#include "util/CpuAffinity.h"
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <iostream>
+
 namespace
 {
 
@@ -62,6 +65,30 @@ std::string getOpBackends(std::unordered_map<ir::OpCode, std::string> &opcode_to
   return opbackends;
 }
 
+std::string getParallelThreads(const std::unordered_map<std::string, uint32_t> &parallel_threads)
+{
+  std::string str;
+  for (const auto &pair : parallel_threads)
+  {
+    if (!str.empty())
+      str += ", ";
+    str += pair.first + "=" + std::to_string(pair.second);
+  }
+  return str;
+}
+
+std::string getCpuList(const std::vector<uint32_t> &cpus)
+{
+  std::string str;
+  for (const auto cpu : cpus)
+  {
+    if (!str.empty())
+      str += ",";
+    str += std::to_string(cpu);
+  }
+  return str;
+}
+
 } // namespace
 
 namespace onert
@@ -75,12 +102,30 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   CompilerOptions options;
   options.backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.trace_buffer_size = util::getConfigInt(util::config::TRACE_BUFFER_SIZE);
+  if (util::getConfigBool(util::config::OP_STATS))
+    options.op_stats = std::make_shared<exec::OpStats>();
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_adaptive = util::getConfigBool(util::config::ADAPTIVE_SCHEDULING);
+  options.he_adaptive_interval = util::getConfigInt(util::config::ADAPTIVE_SCHEDULING_INTERVAL);
+  options.he_adaptive_threshold = util::getConfigInt(util::config::ADAPTIVE_SCHEDULING_THRESHOLD);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.cpu_threads = util::getConfigInt(util::config::CPU_THREADS);
+  try
+  {
+    options.cpu_affinity = util::parseCpuList(util::getConfigString(util::config::CPU_AFFINITY));
+  }
+  catch (const std::invalid_argument &e)
+  {
+    // Run on any CPU rather than failing the session for a malformed list
+    std::cerr << "W: Ignore CPU_AFFINITY config: " << e.what() << std::endl;
+  }
+  options.executor_cache_size = util::getConfigInt(util::config::EXECUTOR_CACHE_SIZE);
+  options.executor_cache_memory = util::getConfigInt(util::config::EXECUTOR_CACHE_MEMORY);
 
   {
     // Backend for all
@@ -123,6 +168,26 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
       ms_options.index_to_backend.emplace(ir::OperationIndex{key}, val);
     }
   }
+
+  {
+    // Number of worker threads of each backend for Parallel executor (e.g. "cpu=2;acl_cl=1")
+    auto map_str = util::getConfigString(util::config::PARALLEL_THREADS);
+    auto key_val_list = nnfw::misc::split(map_str, ';');
+    for (const auto &key_val_str : key_val_list)
+    {
+      if (key_val_str.empty())
+      {
+        continue;
+      }
+
+      auto key_val = nnfw::misc::split(key_val_str, '=');
+      const auto &backend_id = key_val.at(0);
+      auto num_threads = std::stoi(key_val.at(1));
+      if (num_threads < 1)
+        throw std::runtime_error("Invalid number of threads for backend " + backend_id);
+      options.parallel_threads[backend_id] = static_cast<uint32_t>(num_threads);
+    }
+  }
   return options;
 }
 
@@ -171,8 +236,13 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "trace_buffer_size        : " << _options.trace_buffer_size << std::endl;
+    VERBOSE(Compiler) << "op_stats                 : " << (_options.op_stats != nullptr)
+                      << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
+    VERBOSE(Compiler) << "parallel_threads         : "
+                      << getParallelThreads(_options.parallel_threads) << std::endl;
     VERBOSE(Compiler) << "manual backend_for_all   : "
                       << _options.manual_scheduler_options.backend_for_all << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : "
@@ -180,8 +250,20 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                       << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "he_adaptive              : " << _options.he_adaptive << std::endl;
+    VERBOSE(Compiler) << "he_adaptive_interval     : " << _options.he_adaptive_interval
+                      << std::endl;
+    VERBOSE(Compiler) << "he_adaptive_threshold    : " << _options.he_adaptive_threshold
+                      << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
-    VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl
+    VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "cpu_threads              : " << _options.cpu_threads << std::endl;
+    VERBOSE(Compiler) << "cpu_affinity             : " << getCpuList(_options.cpu_affinity)
+                      << std::endl;
+    VERBOSE(Compiler) << "executor_cache_size      : " << _options.executor_cache_size
+                      << std::endl;
+    VERBOSE(Compiler) << "executor_cache_memory    : " << _options.executor_cache_memory
+                      << std::endl
                       << std::noboolalpha;
   }
 
@@ -217,6 +299,34 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   if (_options.he_profiling_mode)
     checkProfilerConditions();
 
+  if (_options.executor_cache_size < 0 || _options.executor_cache_memory < 0)
+    throw std::runtime_error("Invalid size or memory of executor cache");
+  if (_options.executor_cache_size > 0 && _options.he_adaptive)
+    throw std::runtime_error("Executor cache does not work with adaptive scheduling");
+
+  if (_options.he_adaptive && !_options.he_exec_time)
+  {
+    if (!_options.he_scheduler)
+      throw std::runtime_error("Heterogeneous scheduler must be enabled for adaptive scheduling.");
+    if (_options.he_profiling_mode)
+      throw std::runtime_error("Adaptive scheduling does not work in profiling mode");
+    if (_options.he_adaptive_interval < 1 || _options.he_adaptive_threshold < 0 ||
+        _options.he_adaptive_threshold >= 100)
+      throw std::runtime_error("Invalid interval or threshold of adaptive scheduling");
+
+    // HEScheduler and executors share exec times, which are sampled while running
+    auto &backend_manager = BackendManager::get();
+    std::vector<const backend::Backend *> backends;
+    for (const auto &backend_str : _options.backend_list)
+    {
+      backend_manager.loadBackend(backend_str);
+      if (auto backend = backend_manager.get(backend_str))
+        backends.push_back(backend);
+    }
+    _options.he_exec_time = std::make_shared<exec::ExecTime>(backends);
+    _options.he_sampled_exec_time = _options.he_exec_time;
+  }
+
   /***************************************************
    * Backend independent analysis & optimization phase
    ***************************************************/
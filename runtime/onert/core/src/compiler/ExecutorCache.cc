@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/ExecutorCache.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+
+using namespace onert;
+
+std::vector<ir::Shape> inputShapes(const ir::Graph &graph)
+{
+  std::vector<ir::Shape> shapes;
+  for (const auto &index : graph.getInputs())
+    shapes.emplace_back(graph.operands().at(index).shape());
+  return shapes;
+}
+
+// Sum of static non-constant operands, which is an upper bound of planned memory as the memory
+// planner lets operands share memory. Constants are not counted, as they are shared with the model.
+size_t estimateMemory(exec::ExecutorMap &executors)
+{
+  size_t memory = 0;
+  for (auto &pair : executors)
+  {
+    pair.second->graph().operands().iterate([&](const ir::OperandIndex &, const ir::Operand &obj) {
+      const auto &info = obj.info();
+      if (!info.isConstant() && !info.isDynamic() && !info.shape().hasUnspecifiedDims())
+        memory += info.total_size();
+    });
+  }
+  return memory;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+ExecutorCache::ExecutorCache(SubgraphsFactory factory, const CompilerOptions &options,
+                             const std::shared_ptr<exec::ExecutorMap> &executors)
+  : _factory{std::move(factory)}, _options(options), _base_executors{executors}
+{
+  assert(_base_executors != nullptr);
+  _base_input_shapes = inputShapes(_base_executors->at(ir::SubgraphIndex{0})->graph());
+}
+
+std::shared_ptr<exec::ExecutorMap>
+ExecutorCache::get(const std::vector<ir::Shape> &input_shapes)
+{
+  if (input_shapes == _base_input_shapes)
+    return _base_executors;
+
+  auto it = std::find_if(_entries.begin(), _entries.end(), [&](const std::shared_ptr<Entry> &e) {
+    return e->input_shapes == input_shapes;
+  });
+
+  std::shared_ptr<Entry> entry;
+  if (it != _entries.end())
+  {
+    entry = *it;
+    _entries.erase(it);
+  }
+  else
+  {
+    entry = compile(input_shapes);
+    _memory += entry->memory;
+  }
+  _entries.push_front(entry);
+  evict();
+
+  // Share ownership of the entry, so that its tracing context outlives the executors
+  return std::shared_ptr<exec::ExecutorMap>(entry, entry->executors.get());
+}
+
+std::shared_ptr<ExecutorCache::Entry>
+ExecutorCache::compile(const std::vector<ir::Shape> &input_shapes)
+{
+  auto subgs = _factory();
+  auto &primary = *subgs->primary();
+  if (input_shapes.size() != primary.getInputs().size())
+    throw std::runtime_error{"ExecutorCache: Wrong number of input shapes"};
+
+  // Static shape inference in compilation propagates them, like shapes set before preparation
+  for (uint32_t i = 0; i < input_shapes.size(); ++i)
+    primary.operands().at(primary.getInputs().at(i)).info().shape(input_shapes[i]);
+
+  auto entry = std::make_shared<Entry>();
+  entry->input_shapes = input_shapes;
+  entry->tracing_ctx = std::make_unique<util::TracingCtx>(subgs.get());
+  Compiler compiler{subgs, entry->tracing_ctx.get()};
+  compiler.options() = _options;
+  compiler.options().tracing_ctx = entry->tracing_ctx.get();
+  // Executors for other shapes must not overwrite the trace file of the first executors
+  compiler.options().trace_filepath.clear();
+  subgs.reset();
+  entry->executors = compiler.compile();
+  entry->memory = estimateMemory(*entry->executors);
+
+  VERBOSE(ExecutorCache) << "Compiled for new input shapes (" << entry->memory << " bytes)"
+                         << std::endl;
+  return entry;
+}
+
+void ExecutorCache::evict()
+{
+  const size_t memory_limit = static_cast<size_t>(_options.executor_cache_memory) << 20;
+  // The most recently used one is kept even if it exceeds the limits alone
+  while (_entries.size() > 1 &&
+         (_entries.size() > static_cast<size_t>(_options.executor_cache_size) ||
+          (memory_limit > 0 && _memory > memory_limit)))
+  {
+    _memory -= _entries.back()->memory;
+    _entries.pop_back();
+    VERBOSE(ExecutorCache) << "Evicted executors, " << _entries.size() << " left" << std::endl;
+  }
+}
+
+} // namespace compiler
+} // namespace onert
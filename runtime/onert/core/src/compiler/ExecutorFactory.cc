@@ -16,6 +16,7 @@
 
 #include "ExecutorFactory.h"
 
+#include <algorithm>
 #include <deque>
 #include <functional>
 #include "ir/OperationCloner.h"
@@ -33,6 +34,7 @@
 #include "backend/builtin/KernelGenerator.h"
 #include "backend/builtin/UserTensor.h"
 #include "backend/builtin/TensorBuilder.h"
+#include "util/CpuAffinity.h"
 #include "util/TracingCtx.h"
 #include "dumper/text/GraphDumper.h"
 
@@ -119,8 +121,15 @@ void initializeSubgraphIOTensors(compiler::LoweredGraph &lowered_graph,
   }
 }
 
-backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, bool linear_executor)
+backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph,
+                                               const compiler::CompilerOptions &options)
 {
+  const bool linear_executor = options.executor == "Linear";
+  // If only CPUs are given, use one thread for each
+  int cpu_threads = options.cpu_threads;
+  if (cpu_threads < 1 && !options.cpu_affinity.empty())
+    cpu_threads = static_cast<int>(options.cpu_affinity.size());
+
   backend::BackendContexts contexts;
   auto &backend_manager = compiler::BackendManager::get();
 
@@ -196,6 +205,21 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
       }
     });
 
+  // Backends which run operations split the threads and the CPUs, as their thread pools cannot be
+  // shared, not to run more threads than given in total. Others get a single thread.
+  std::vector<const backend::Backend *> cpu_backends;
+  for (const auto &pair : context_data_map)
+  {
+    if (pair.second.graph->operations().size() > 0)
+      cpu_backends.push_back(pair.first);
+  }
+  std::sort(cpu_backends.begin(), cpu_backends.end(),
+            [](const backend::Backend *lhs, const backend::Backend *rhs) {
+              return lhs->config()->id() < rhs->config()->id();
+            });
+  const auto cpu_lists = util::splitCpuList(options.cpu_affinity, cpu_backends.size());
+  const int num_cpu_backends = static_cast<int>(cpu_backends.size());
+
   // Create contexts
   auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &pair : context_data_map)
@@ -219,6 +243,19 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
     std::copy_if(whole_op_order.begin(), whole_op_order.end(), std::back_inserter(data.op_order),
                  [&](const auto &ind) { return data.graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
+    data.cpu_threads = cpu_threads;
+    if (cpu_threads > 0)
+    {
+      data.cpu_threads = 1;
+      const auto it = std::find(cpu_backends.begin(), cpu_backends.end(), backend);
+      if (it != cpu_backends.end())
+      {
+        const int i = static_cast<int>(it - cpu_backends.begin());
+        data.cpu_threads = std::max(
+          1, cpu_threads * (i + 1) / num_cpu_backends - cpu_threads * i / num_cpu_backends);
+        data.cpu_affinity = cpu_lists[i];
+      }
+    }
     data.custom_kernel_builder = lgraph.graph().getKernelBuilder();
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
@@ -289,8 +326,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
 {
   auto graph = lowered_graph->graph();
 
-  backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options.executor == "Linear");
+  backend::BackendContexts backend_contexts = createBackendContexts(*lowered_graph, options);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -401,7 +437,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
       auto &fn_seq = pair.second;
       auto &op = lowered_graph->graph().operations().at(op_ind);
       auto lower_info = lowered_graph->lower_info().operation.getRawPtr(op_ind);
-      if (options.he_profiling_mode)
+      if (options.he_profiling_mode || options.he_sampled_exec_time)
         fn_seq->wrap<SyncFunction>(lower_info->backend()->config());
       if (!dealloc_list_map[op_ind].empty())
         fn_seq->append(std::make_unique<DeallocFunction>(dealloc_list_map[op_ind]));
@@ -418,10 +454,23 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
-      options.trace_filepath, exec->graph(), options.tracing_ctx);
+      options.trace_filepath, exec->graph(), options.tracing_ctx, options.trace_buffer_size,
+      exec->dynamicMemoryManagers());
     exec->addObserver(std::move(ctp));
   }
 
+  if (options.op_stats)
+  {
+    exec->addObserver(std::make_unique<exec::StatsObserver>(
+      options.op_stats, options.tracing_ctx->getSubgraphIndex(&exec->graph()), exec->graph()));
+  }
+
+  if (options.he_sampled_exec_time)
+  {
+    exec->addObserver(
+      std::make_unique<exec::ExecTimeObserver>(options.he_sampled_exec_time, exec->graph()));
+  }
+
   return exec;
 }
 
@@ -429,8 +478,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   std::unique_ptr<compiler::LoweredGraph> lowered_graph, const compiler::CompilerOptions &options,
   const std::shared_ptr<exec::ExecutorMap> &executor_map, bool parallel)
 {
-  backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options.executor == "Linear");
+  backend::BackendContexts backend_contexts = createBackendContexts(*lowered_graph, options);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -484,7 +532,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
       auto &fn_seq = pair.second;
       auto &op = lowered_graph->graph().operations().at(op_ind);
       auto lower_info = lowered_graph->lower_info().operation.getRawPtr(op_ind);
-      if (options.he_profiling_mode)
+      if (options.he_profiling_mode || options.he_sampled_exec_time)
         fn_seq->wrap<SyncFunction>(lower_info->backend()->config());
       builder.append(op_ind, {op_ind, &op, lower_info, std::move(fn_seq)});
     }
@@ -496,7 +544,8 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   if (parallel)
   {
     exec = new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts),
-                                      tensor_regs, std::move(code_map), options.tracing_ctx};
+                                      tensor_regs, std::move(code_map), options.tracing_ctx,
+                                      options.parallel_threads};
   }
   else
   {
@@ -521,10 +570,23 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
-      options.trace_filepath, exec->graph(), options.tracing_ctx);
+      options.trace_filepath, exec->graph(), options.tracing_ctx, options.trace_buffer_size,
+      exec->dynamicMemoryManagers());
     exec->addObserver(std::move(ctp));
   }
 
+  if (options.op_stats)
+  {
+    exec->addObserver(std::make_unique<exec::StatsObserver>(
+      options.op_stats, options.tracing_ctx->getSubgraphIndex(&exec->graph()), exec->graph()));
+  }
+
+  if (options.he_sampled_exec_time)
+  {
+    exec->addObserver(
+      std::make_unique<exec::ExecTimeObserver>(options.he_sampled_exec_time, exec->graph()));
+  }
+
   return exec;
 }
 
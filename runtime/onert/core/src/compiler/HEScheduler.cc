@@ -237,6 +237,64 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
   return std::move(_backend_resolver);
 }
 
+int64_t HEScheduler::estimateMakespan(const ir::Graph &graph,
+                                      const BackendResolver &backend_resolver)
+{
+  // Same as ESTAndExecTime()
+  const int64_t CPU_DELAY = 2;
+
+  ir::OperationIndexMap<int64_t> ops_eft;
+  std::unordered_map<const backend::Backend *, int64_t> backends_avail_time;
+  int64_t makespan = 0;
+  for (const auto &index : graph.topolSortOperations())
+  {
+    const auto &node = graph.operations().at(index);
+    const auto backend = backend_resolver.getBackend(index);
+    const bool quant = isQuant(graph, node);
+    const auto size = getOperationsFlattenedIOSize(graph, node);
+    auto exec_time = _exec_time->getOperationExecTime(backend, node.name(), quant, size);
+    if (exec_time == _exec_time->NOT_FOUND)
+      return _exec_time->NOT_FOUND;
+    if (backend == _cpu_backend && _is_parallel_exec)
+      exec_time *= CPU_DELAY;
+
+    // Latest finishing time of parents and data transfer cost from their backends
+    int64_t max_pred_eft = 0;
+    int64_t transfer_cost = 0;
+    for (const auto &input : node.getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto &operand = graph.operands().at(input);
+      const auto def = operand.getDef();
+      if (!def.valid())
+        continue;
+
+      max_pred_eft = std::max(max_pred_eft, ops_eft.at(def));
+      const auto parent_backend = backend_resolver.getBackend(def);
+      if (parent_backend != backend)
+      {
+        const bool operand_quant = operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM;
+        transfer_cost +=
+          getPermuteTime(parent_backend, backend, operand_quant, operand.info().total_size() * 2);
+      }
+    }
+
+    // Operations run one by one if not parallel
+    if (!_is_parallel_exec)
+    {
+      makespan += transfer_cost + exec_time;
+      ops_eft[index] = makespan;
+      continue;
+    }
+
+    auto &avail_time = backends_avail_time[backend];
+    const auto eft = std::max(max_pred_eft + transfer_cost, avail_time) + exec_time;
+    avail_time = eft;
+    ops_eft[index] = eft;
+    makespan = std::max(makespan, eft);
+  }
+  return makespan;
+}
+
 int64_t HEScheduler::getOpTime(const backend::Backend *backend, const std::string &operation,
                                bool quant, uint32_t size)
 {
@@ -63,7 +63,8 @@ public:
       _all_backends.push_back(entry);
     }
     _backend_resolver = std::make_unique<compiler::BackendResolver>();
-    _exec_time = std::make_unique<exec::ExecTime>(_all_backends);
+    _exec_time = options.he_exec_time ? options.he_exec_time
+                                      : std::make_shared<exec::ExecTime>(_all_backends);
 
     // Find cpu backend
     auto cpu_backend_it =
@@ -84,6 +85,19 @@ public:
    */
   std::unique_ptr<compiler::BackendResolver> schedule(const ir::Graph &graph) final;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> getIndexedRanks() { return _op_to_rank; }
+  /**
+   * @brief   Estimate makespan of a graph with a backend assignment
+   *
+   * @note    This follows the cost model of scheduling without finding gaps between scheduled
+   *          operations, so that assignments can be compared with each other.
+   *
+   * @param[in] graph graph to estimate
+   * @param[in] backend_resolver backend assignment of all operations in the graph
+   *
+   * @return  estimated makespan in microseconds, or ExecTime::NOT_FOUND if exec time of an
+   *          operation on its backend is unknown
+   */
+  int64_t estimateMakespan(const ir::Graph &graph, const BackendResolver &backend_resolver);
 
 private:
   bool isNodeProfiled(const ir::Operation &);
@@ -170,7 +184,7 @@ private:
   std::multimap<int64_t, ir::OperationIndex, std::greater<int64_t>> _rank_to_op;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
-  std::unique_ptr<exec::ExecTime> _exec_time;
+  std::shared_ptr<exec::ExecTime> _exec_time;
   const ir::Graph *_graph{nullptr};
   std::vector<const backend::Backend *> _all_backends;
   const backend::Backend *_cpu_backend{nullptr}; // TODO Change this to _builtin_backend
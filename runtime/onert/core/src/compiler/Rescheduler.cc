@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/Rescheduler.h"
+
+#include "compiler/BackendManager.h"
+#include "compiler/HEScheduler.h"
+#include "exec/ExecTime.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/ExecutorBase.h"
+#include "util/logging.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace compiler
+{
+
+Rescheduler::Rescheduler(SubgraphsFactory factory, const CompilerOptions &options)
+  : _factory{std::move(factory)}, _options(options), _backends{BackendManager::get().getAll()}
+{
+  assert(_options.he_exec_time && _options.he_sampled_exec_time);
+
+  // Nothing is sampled yet, so this is the same as the schedule of the current executors
+  _current = schedule(*_factory(), _options);
+}
+
+Rescheduler::~Rescheduler()
+{
+  if (_job.valid())
+    _job.wait();
+}
+
+void Rescheduler::notifyRun()
+{
+  if (++_runs % _options.he_adaptive_interval != 0)
+    return;
+
+  // Skip if the previous re-scheduling has not finished yet
+  if (_job.valid() && _job.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+    return;
+
+  _job = std::async(std::launch::async, [this]() { reschedule(); });
+}
+
+std::shared_ptr<exec::ExecutorMap>
+Rescheduler::takeExecutors(std::unique_ptr<util::TracingCtx> &tracing_ctx)
+{
+  std::shared_ptr<exec::ExecutorMap> executors;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    tracing_ctx = std::move(_new_tracing_ctx);
+    executors = std::move(_new_executors);
+  }
+
+  // Tracing starts here, so that executors replaced before being taken do not go into the trace.
+  // The trace file is written when all the executors tracing into it are destroyed.
+  if (executors && !_options.trace_filepath.empty())
+  {
+    for (auto &e : *executors)
+    {
+      auto exec = dynamic_cast<exec::ExecutorBase *>(e.second.get());
+      assert(exec);
+      exec->addObserver(std::make_unique<exec::TracingObserver>(
+        _options.trace_filepath, exec->graph(), tracing_ctx.get(), _options.trace_buffer_size,
+        exec->dynamicMemoryManagers()));
+    }
+  }
+  return executors;
+}
+
+Rescheduler::Assignment Rescheduler::schedule(const ir::Subgraphs &subgs,
+                                              const CompilerOptions &options) const
+{
+  Assignment assignment;
+  subgs.iterate([&](const ir::SubgraphIndex &index, const ir::Graph &subg) {
+    assignment[index] = HEScheduler(_backends, options).schedule(subg);
+  });
+  return assignment;
+}
+
+int64_t Rescheduler::estimateMakespan(const ir::Subgraphs &subgs, const Assignment &assignment,
+                                      const CompilerOptions &options) const
+{
+  // NOTE Subgraphs of control flow operations may not run at all or run several times, but they
+  //      are just summed up
+  int64_t makespan = 0;
+  subgs.iterate([&](const ir::SubgraphIndex &index, const ir::Graph &subg) {
+    if (makespan == exec::ExecTime::NOT_FOUND)
+      return;
+
+    const auto subg_makespan =
+      HEScheduler(_backends, options).estimateMakespan(subg, *assignment.at(index));
+    if (subg_makespan == exec::ExecTime::NOT_FOUND)
+      makespan = exec::ExecTime::NOT_FOUND;
+    else
+      makespan += subg_makespan;
+  });
+  return makespan;
+}
+
+void Rescheduler::reschedule()
+{
+  if (_cooldown > 0)
+  {
+    --_cooldown;
+    return;
+  }
+
+  try
+  {
+    // Schedule with a snapshot of exec times, so that compilation gets the same schedule while
+    // executors keep sampling
+    auto options = _options;
+    options.he_exec_time = std::make_shared<exec::ExecTime>(*_options.he_sampled_exec_time);
+    // Executors share op stats with the current ones, and are traced once they are taken
+    options.trace_filepath.clear();
+
+    auto subgs = _factory();
+    auto candidate = schedule(*subgs, options);
+    const auto current_makespan = estimateMakespan(*subgs, _current, options);
+    const auto candidate_makespan = estimateMakespan(*subgs, candidate, options);
+    VERBOSE(Rescheduler) << "Estimated makespan: current " << current_makespan << "us, new "
+                         << candidate_makespan << "us" << std::endl;
+
+    if (current_makespan == exec::ExecTime::NOT_FOUND ||
+        candidate_makespan == exec::ExecTime::NOT_FOUND ||
+        candidate_makespan * 100 > current_makespan * (100 - _options.he_adaptive_threshold))
+    {
+      _wins = 0;
+      return;
+    }
+    if (++_wins < REQUIRED_WINS)
+      return;
+
+    auto tracing_ctx = std::make_unique<util::TracingCtx>(subgs.get());
+    Compiler compiler{subgs, tracing_ctx.get()};
+    compiler.options() = options;
+    compiler.options().tracing_ctx = tracing_ctx.get();
+    subgs.reset();
+    auto executors = compiler.compile();
+    VERBOSE(Rescheduler) << "Recompiled with a new schedule" << std::endl;
+
+    _current = std::move(candidate);
+    _wins = 0;
+    _cooldown = COOLDOWN;
+
+    // Executors not taken yet are replaced, before their tracing context
+    std::lock_guard<std::mutex> lock{_mutex};
+    _new_executors = std::move(executors);
+    _new_tracing_ctx = std::move(tracing_ctx);
+  }
+  catch (const std::exception &e)
+  {
+    // Keep running with the current executors
+    VERBOSE(Rescheduler) << "Failed to re-schedule: " << e.what() << std::endl;
+    _wins = 0;
+  }
+}
+
+} // namespace compiler
+} // namespace onert
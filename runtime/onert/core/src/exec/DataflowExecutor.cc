@@ -102,19 +102,20 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
   _output_info.resize(next_job_index);
   _initial_input_info.resize(next_job_index, 0);
 
+  // Find consumers of each output from use-def chains of the graph, which is linear to the number
+  // of edges rather than scanning all the operations for every output
+  const auto &operands = _lowered_graph->graph().operands();
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
     auto job_index = op_to_job[op_ind];
-    for (auto output : op.getOutputs())
+    for (auto output : op.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
     {
       // Update output and input info
-      operations.iterate([&](const ir::OperationIndex &op_cur_ind, const ir::Operation &op_cur) {
-        if (op_cur.getInputs().contains(output))
-        {
-          auto dep_index = op_to_job[op_cur_ind];
-          ++_initial_input_info[dep_index];
-          _output_info[job_index].push_back(dep_index);
-        }
-      });
+      for (const auto &op_cur_ind : operands.at(output).getUses())
+      {
+        auto dep_index = op_to_job.at(op_cur_ind);
+        ++_initial_input_info[dep_index];
+        _output_info[job_index].push_back(dep_index);
+      }
     }
   });
   for (const auto &s : op_to_job)
@@ -26,10 +26,14 @@ namespace onert
 namespace exec
 {
 
+const int64_t ExecTime::NOT_FOUND;
+
 int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant,
                                        uint32_t op_size) const
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   auto found_backend = _measurements.find(backend);
   if (found_backend == _measurements.end())
     return NOT_FOUND; // no execution time for this backend
@@ -98,6 +102,8 @@ void ExecTime::updateOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant, uint32_t op_size,
                                        int64_t time)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   // If the op is not implemented for some input, it should not be scheduled
   const auto &recs = _measurements[backend][operation][quant];
   if (time == getMax() ||
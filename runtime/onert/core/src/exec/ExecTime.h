@@ -23,6 +23,7 @@
 #include <memory>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -30,6 +31,11 @@ namespace onert
 {
 namespace exec
 {
+/**
+ * @brief Execution times of operations on backends
+ *
+ * All methods are thread-safe, so that executors can update it while HEScheduler reads it.
+ */
 class ExecTime
 {
 public:
@@ -37,6 +43,14 @@ public:
     : _json(backends, _measurements)
   {
   }
+  /**
+   * @brief Construct a snapshot of other, which is not affected by later updates of other
+   */
+  ExecTime(const ExecTime &other)
+    : _measurements(other.measurements()), _json(other._json, _measurements)
+  {
+  }
+  ExecTime &operator=(const ExecTime &) = delete;
 
 public:
   /**
@@ -94,9 +108,20 @@ public:
   /**
    * @brief Update metrics file with new data.
    */
-  void storeOperationsExecTime() const { _json.storeOperationsExecTime(); }
+  void storeOperationsExecTime() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _json.storeOperationsExecTime();
+  }
   static const int64_t NOT_FOUND = -1;
 
+private:
+  MeasurementData measurements() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _measurements;
+  }
+
 private:
   /// @brief Measurement data, which is shared with serializer
   MeasurementData _measurements;
@@ -104,6 +129,7 @@ private:
   static const int64_t _MAX = std::numeric_limits<int32_t>::max();
   /// @brief Serializer
   JSON _json;
+  mutable std::mutex _mutex;
 };
 
 } // namespace exec
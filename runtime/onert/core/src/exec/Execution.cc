@@ -154,6 +154,26 @@ void Execution::waitFinish()
 
 bool Execution::isFinished(void) const { return finished; }
 
+void Execution::setExecutors(const std::shared_ptr<ExecutorMap> &executors)
+{
+  assert(executors != nullptr);
+  assert(executors->at(ir::SubgraphIndex{0})->graph().getInputs().size() == _io_desc.inputs.size());
+  assert(executors->at(ir::SubgraphIndex{0})->graph().getOutputs().size() ==
+         _io_desc.outputs.size());
+  _executors = executors;
+
+  const auto &primary_subg = primary_subgraph();
+  for (auto it = _io_desc.dynamic_input_shapes.begin();
+       it != _io_desc.dynamic_input_shapes.end();)
+  {
+    const auto operand_idx = primary_subg.getInputs().at(it->first);
+    if (primary_subg.operands().at(operand_idx).shape() == it->second)
+      it = _io_desc.dynamic_input_shapes.erase(it);
+    else
+      ++it;
+  }
+}
+
 ir::Shape Execution::getInputShape(ir::IOIndex ind) const
 {
   auto itr = _io_desc.dynamic_input_shapes.find(ind);
@@ -16,8 +16,15 @@
 
 #include "exec/ExecutionObservers.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <sstream>
+#include <unordered_map>
+
+// POSIX standard libraries
+#include <sys/time.h>
+#include <sys/resource.h>
 
 #include "util/logging.h"
 #include "exec/IExecutor.h"
@@ -65,6 +72,37 @@ void setUserData(const onert::ir::Graph &g, const onert::ir::Operation *op,
   // add other userData as needed
 }
 
+uint64_t timestamp()
+{
+  auto now = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+bool isDynamicMemoryCounter(TraceEvent::Counter counter)
+{
+  return counter == TraceEvent::Counter::DYNAMIC_ALLOC_CALLS ||
+         counter == TraceEvent::Counter::DYNAMIC_ALLOC_BYTES ||
+         counter == TraceEvent::Counter::DYNAMIC_HEAP_ALLOC_CALLS;
+}
+
+std::string counterName(TraceEvent::Counter counter)
+{
+  switch (counter)
+  {
+    case TraceEvent::Counter::DYNAMIC_ALLOC_CALLS:
+      return "dynamic_alloc_calls";
+    case TraceEvent::Counter::DYNAMIC_ALLOC_BYTES:
+      return "dynamic_alloc_bytes";
+    case TraceEvent::Counter::DYNAMIC_HEAP_ALLOC_CALLS:
+      return "dynamic_heap_alloc_calls";
+    case TraceEvent::Counter::MAXRSS:
+      return "maxrss";
+    case TraceEvent::Counter::MINFLT:
+      return "minflt";
+  }
+  throw std::runtime_error{"Unknown trace counter"};
+}
+
 } // namespace
 
 namespace onert
@@ -113,11 +151,68 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, ir::SubgraphIndex,
   }
 };
 
-TracingObserver::TracingObserver(const std::string &filepath, const ir::Graph &graph,
-                                 const util::TracingCtx *tracing_ctx)
-  : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
-    _tracing_ctx{tracing_ctx}
+ExecTimeObserver::ExecTimeObserver(std::shared_ptr<ExecTime> et, const ir::Graph &graph)
+  : _et{std::move(et)}
+{
+  graph.operations().iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+    if (op_ind.value() >= _samples.size())
+      _samples.resize(op_ind.value() + 1, Sample{"", false, 0, 0, nullptr, 0});
+
+    // Same keys as HEScheduler looks up exec times with
+    auto &sample = _samples[op_ind.value()];
+    sample.name = op.name();
+    for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+      sample.size += graph.operands().at(ind).info().total_size();
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+    {
+      if (graph.operands().at(ind).typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM)
+        sample.quant = true;
+    }
+  });
+}
+
+void ExecTimeObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                      const backend::Backend *)
 {
+  _samples[op_ind.value()].begin = timestamp();
+}
+
+void ExecTimeObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                    const backend::Backend *backend)
+{
+  auto &sample = _samples[op_ind.value()];
+  sample.time = static_cast<int64_t>((timestamp() - sample.begin) / 1000);
+  sample.backend = backend;
+}
+
+void ExecTimeObserver::handleSubgraphEnd(ir::SubgraphIndex)
+{
+  for (auto &sample : _samples)
+  {
+    // Permutations are inserted by lowering, not scheduled by HEScheduler
+    if (sample.backend == nullptr || sample.name == "Permute")
+      continue;
+
+    // ExecTime expects positive exec times
+    _et->updateOperationExecTime(sample.backend, sample.name, sample.quant, sample.size,
+                                 std::max<int64_t>(sample.time, 1));
+    sample.backend = nullptr;
+  }
+}
+
+TracingObserver::TracingObserver(
+  const std::string &filepath, const ir::Graph &graph, const util::TracingCtx *tracing_ctx,
+  size_t trace_capacity, std::vector<const backend::basic::DynamicMemoryManager *> dyn_mem_mgrs)
+  : _recorder{std::make_unique<EventRecorder>(trace_capacity)}, _collector{_recorder.get()},
+    _tracing_ctx{tracing_ctx}, _dyn_mem_mgrs{std::move(dyn_mem_mgrs)}
+{
+  graph.operations().iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+    auto &info = _op_infos[op_ind];
+    info.name = op.name();
+    // add shape of inputs
+    setUserData(graph, &op, info.user_data);
+  });
+
   _event_writer = EventWriter::get(filepath);
   _event_writer->startToUse();
 }
@@ -126,6 +221,7 @@ TracingObserver::~TracingObserver()
 {
   try
   {
+    collect();
     _event_writer->readyToFlush(std::move(_recorder));
   }
   catch (const std::exception &e)
@@ -134,38 +230,180 @@ TracingObserver::~TracingObserver()
   }
 }
 
+uint64_t TracingObserver::record(TraceEvent::Kind kind, TraceEvent::Edge edge,
+                                 ir::SubgraphIndex subg_ind, ir::OperationIndex op_ind,
+                                 const backend::Backend *backend)
+{
+  TraceEvent evt;
+  evt.ts = timestamp();
+  evt.backend = backend;
+  evt.subg_index = subg_ind.value();
+  evt.op_index = op_ind.value();
+  evt.kind = kind;
+  evt.edge = edge;
+  _recorder->record(evt);
+
+// TODO: Add resurece measurement(e.g. RSS)
+// when ready with low overhead in release build
+#ifdef DEBUG
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  recordCounter(evt.ts, TraceEvent::Counter::MAXRSS, ru.ru_maxrss);
+  recordCounter(evt.ts, TraceEvent::Counter::MINFLT, ru.ru_minflt);
+#endif
+
+  return evt.ts;
+}
+
+void TracingObserver::recordCounter(uint64_t ts, TraceEvent::Counter counter, uint64_t value)
+{
+  TraceEvent evt;
+  evt.ts = ts;
+  evt.value = value;
+  evt.kind = TraceEvent::Kind::COUNTER;
+  evt.counter = counter;
+  _recorder->record(evt);
+}
+
+backend::basic::DynamicMemoryStats TracingObserver::dynamicMemoryStats() const
+{
+  backend::basic::DynamicMemoryStats stats;
+  for (const auto mgr : _dyn_mem_mgrs)
+    stats += mgr->stats();
+  return stats;
+}
+
 void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
 {
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::BEGIN, subg_ind.value()});
+  _dyn_mem_stats = dynamicMemoryStats();
+  record(TraceEvent::Kind::SUBG, TraceEvent::Edge::BEGIN, subg_ind);
 }
 
 void TracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex subg_ind,
                                      ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  const auto &op = _graph.operations().at(op_ind);
-  auto ev = EventCollector::OpSeqEvent{_tracing_ctx,     EventCollector::Edge::BEGIN,
-                                       subg_ind.value(), backend_id,
-                                       op_ind.value(),   op.name()};
-  // add shape of inputs
-  setUserData(_graph, &op, ev.userData);
-  _collector.onEvent(ev);
+  record(TraceEvent::Kind::OP, TraceEvent::Edge::BEGIN, subg_ind, op_ind, backend);
 }
 
 void TracingObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_ind,
                                    ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(EventCollector::OpSeqEvent{_tracing_ctx, EventCollector::Edge::END,
-                                                subg_ind.value(), backend_id, op_ind.value(),
-                                                _graph.operations().at(op_ind).name()});
+  record(TraceEvent::Kind::OP, TraceEvent::Edge::END, subg_ind, op_ind, backend);
 }
 
 void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
 {
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
+  const auto ts = record(TraceEvent::Kind::SUBG, TraceEvent::Edge::END, subg_ind);
+  // add dynamic memory allocations during the subgraph execution
+  const auto dyn_mem_stats = dynamicMemoryStats();
+  recordCounter(ts, TraceEvent::Counter::DYNAMIC_ALLOC_CALLS,
+                dyn_mem_stats.num_allocations - _dyn_mem_stats.num_allocations);
+  recordCounter(ts, TraceEvent::Counter::DYNAMIC_ALLOC_BYTES,
+                dyn_mem_stats.allocated_bytes - _dyn_mem_stats.allocated_bytes);
+  recordCounter(ts, TraceEvent::Counter::DYNAMIC_HEAP_ALLOC_CALLS,
+                dyn_mem_stats.num_heap_allocations - _dyn_mem_stats.num_heap_allocations);
+}
+
+void TracingObserver::collect()
+{
+  const auto dropped = _recorder->dropped_trace_events();
+  if (dropped > 0)
+    VERBOSE(TracingObserver) << "Oldest " << dropped << " trace events were overwritten"
+                             << std::endl;
+
+  const auto events = _recorder->trace_events();
+
+  // Skip a subgraph run whose beginning was overwritten
+  auto it = std::find_if(events.begin(), events.end(), [](const TraceEvent &evt) {
+    return evt.kind == TraceEvent::Kind::SUBG && evt.edge == TraceEvent::Edge::BEGIN;
+  });
+
+  std::unordered_map<const backend::Backend *, std::string> backend_ids;
+  for (; it != events.end(); ++it)
+  {
+    const auto &evt = *it;
+    const uint64_t ts = evt.ts / 1000; // in microseconds
+    const auto edge =
+      evt.edge == TraceEvent::Edge::BEGIN ? EventCollector::Edge::BEGIN : EventCollector::Edge::END;
+    switch (evt.kind)
+    {
+      case TraceEvent::Kind::SUBG:
+      {
+        auto ev = EventCollector::SubgEvent{_tracing_ctx, edge, evt.subg_index};
+        // Dynamic memory counters sampled at the end of subgraph follow it
+        for (auto next = it + 1; next != events.end() && next->kind == TraceEvent::Kind::COUNTER &&
+                                 next->ts == evt.ts;
+             ++next)
+        {
+          if (isDynamicMemoryCounter(next->counter))
+            ev.userData.emplace_back(counterName(next->counter), std::to_string(next->value));
+        }
+        _collector.onEvent(ev, ts);
+        break;
+      }
+      case TraceEvent::Kind::OP:
+      {
+        auto backend_id = backend_ids.find(evt.backend);
+        if (backend_id == backend_ids.end())
+          backend_id = backend_ids.emplace(evt.backend, evt.backend->config()->id()).first;
+
+        const auto &op_info = _op_infos.at(ir::OperationIndex{evt.op_index});
+        auto ev = EventCollector::OpSeqEvent{_tracing_ctx,       edge,         evt.subg_index,
+                                             backend_id->second, evt.op_index, op_info.name};
+        if (edge == EventCollector::Edge::BEGIN)
+          ev.userData = op_info.user_data;
+        _collector.onEvent(ev, ts);
+        break;
+      }
+      case TraceEvent::Kind::COUNTER:
+      {
+        if (!isDynamicMemoryCounter(evt.counter))
+          _collector.onCounter(counterName(evt.counter), evt.value, ts);
+        break;
+      }
+    }
+  }
+}
+
+StatsObserver::StatsObserver(std::shared_ptr<OpStats> stats, ir::SubgraphIndex subg_ind,
+                             const ir::Graph &graph)
+  : _stats{std::move(stats)}, _subg_entry{nullptr}, _subg_begin{0}
+{
+  graph.operations().iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+    // NOTE Sizes of dynamic tensors are unknown at compilation, so they are not counted
+    uint64_t bytes = 0;
+    for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+      bytes += graph.operands().at(ind).info().total_size();
+
+    if (op_ind.value() >= _op_entries.size())
+    {
+      _op_entries.resize(op_ind.value() + 1, nullptr);
+      _op_begins.resize(op_ind.value() + 1, 0);
+    }
+    _op_entries[op_ind.value()] = &_stats->entry(subg_ind, op_ind, op.name(), bytes);
+  });
+  _subg_entry = &_stats->entry(subg_ind, ir::OperationIndex{}, "Subgraph", 0);
+}
+
+void StatsObserver::handleSubgraphBegin(ir::SubgraphIndex) { _subg_begin = timestamp(); }
+
+void StatsObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                   const backend::Backend *)
+{
+  _op_begins[op_ind.value()] = timestamp();
+}
+
+void StatsObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                 const backend::Backend *backend)
+{
+  auto entry = _op_entries[op_ind.value()];
+  entry->latency.add(timestamp() - _op_begins[op_ind.value()]);
+  entry->backend.store(backend, std::memory_order_relaxed);
+}
+
+void StatsObserver::handleSubgraphEnd(ir::SubgraphIndex)
+{
+  _subg_entry->latency.add(timestamp() - _subg_begin);
 }
 
 } // namespace exec
@@ -20,9 +20,12 @@
 #include "exec/IFunction.h"
 #include "ir/Index.h"
 #include "ir/Operation.h"
+#include "ir/OperationIndexMap.h"
 #include "ExecTime.h"
+#include "backend/basic/MemoryManager.h"
 #include "util/ITimer.h"
 #include "exec/IExecutor.h"
+#include "exec/OpStats.h"
 #include "util/EventCollector.h"
 #include "util/EventRecorder.h"
 #include "util/EventWriter.h"
@@ -70,11 +73,47 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer to sample exec times of operations into ExecTime while running
+ *
+ * Unlike ProfileObserver, it measures with the CPU clock and does not store ExecTime to file, so
+ * that HEScheduler can re-schedule with exec times of normal runs.
+ */
+class ExecTimeObserver : public IExecutionObserver
+{
+public:
+  ExecTimeObserver(std::shared_ptr<ExecTime> et, const ir::Graph &graph);
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  struct Sample
+  {
+    std::string name;
+    bool quant;
+    uint32_t size;
+    uint64_t begin;
+    // Backend and exec time in microseconds of the last run, nullptr if not sampled yet
+    const backend::Backend *backend;
+    int64_t time;
+  };
+
+private:
+  std::shared_ptr<ExecTime> _et;
+  // Indexed by operation index, as StatsObserver does
+  std::vector<Sample> _samples;
+};
+
 class TracingObserver : public IExecutionObserver
 {
 public:
   TracingObserver(const std::string &filepath, const ir::Graph &graph,
-                  const util::TracingCtx *tracing_ctx);
+                  const util::TracingCtx *tracing_ctx,
+                  size_t trace_capacity = EventRecorder::DEFAULT_TRACE_CAPACITY,
+                  std::vector<const backend::basic::DynamicMemoryManager *> dyn_mem_mgrs = {});
   ~TracingObserver();
   void handleSubgraphBegin(ir::SubgraphIndex) override;
   void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
@@ -83,12 +122,61 @@ public:
                     const backend::Backend *) override;
   void handleSubgraphEnd(ir::SubgraphIndex) override;
 
+private:
+  // Return timestamp of the recorded event
+  uint64_t record(TraceEvent::Kind kind, TraceEvent::Edge edge, ir::SubgraphIndex subg_ind,
+                  ir::OperationIndex op_ind = ir::OperationIndex{},
+                  const backend::Backend *backend = nullptr);
+  void recordCounter(uint64_t ts, TraceEvent::Counter counter, uint64_t value);
+  backend::basic::DynamicMemoryStats dynamicMemoryStats() const;
+  // Build events for EventWriter from recorded TraceEvents
+  void collect();
+
+private:
+  struct OperationInfo
+  {
+    std::string name;
+    decltype(EventCollector::Event::userData) user_data;
+  };
+
 private:
   std::unique_ptr<EventRecorder> _recorder;
   EventCollector _collector;
-  const ir::Graph &_graph;
+  // Operation information to build events, taken at construction as the graph may be destroyed
+  // before this observer
+  ir::OperationIndexMap<OperationInfo> _op_infos;
   EventWriter *_event_writer;
   const util::TracingCtx *_tracing_ctx;
+  // Dynamic memory managers of the backends which the subgraph runs on
+  std::vector<const backend::basic::DynamicMemoryManager *> _dyn_mem_mgrs;
+  // Counters of dynamic memory at the beginning of the subgraph
+  backend::basic::DynamicMemoryStats _dyn_mem_stats;
+};
+
+/**
+ * @brief Observer to gather latencies of operations and the subgraph into OpStats
+ *
+ * It only reads the clock and updates atomic counters while executing, so it can be always on.
+ */
+class StatsObserver : public IExecutionObserver
+{
+public:
+  StatsObserver(std::shared_ptr<OpStats> stats, ir::SubgraphIndex subg_ind, const ir::Graph &graph);
+  void handleSubgraphBegin(ir::SubgraphIndex) override;
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  std::shared_ptr<OpStats> _stats;
+  OpStats::Entry *_subg_entry;
+  uint64_t _subg_begin;
+  // Indexed by operation index. An operation begins and ends on the same thread and it does not
+  // run concurrently in an executor, so begin timestamps need no synchronization.
+  std::vector<OpStats::Entry *> _op_entries;
+  std::vector<uint64_t> _op_begins;
 };
 
 } // namespace exec
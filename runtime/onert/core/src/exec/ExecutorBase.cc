@@ -17,10 +17,14 @@
 #include "ExecutorBase.h"
 #include "ShapeConverter.h"
 
+#include "backend/basic/TensorRegistry.h"
+#include "backend/builtin/BackendContext.h"
 #include "backend/builtin/UserTensor.h"
 #include "util/logging.h"
 #include "misc/polymorphic_downcast.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -48,6 +52,34 @@ ExecutorBase::ExecutorBase(std::unique_ptr<compiler::LoweredGraph> &&lowered_gra
   build_tensor_list(_graph.getOutputs(), _output_tensors);
 }
 
+std::vector<const backend::basic::DynamicMemoryManager *>
+ExecutorBase::dynamicMemoryManagers() const
+{
+  std::vector<const backend::basic::DynamicMemoryManager *> mgrs;
+  auto add = [&](const backend::basic::DynamicMemoryManager *mgr) {
+    if (mgr != nullptr && std::find(mgrs.begin(), mgrs.end(), mgr) == mgrs.end())
+      mgrs.push_back(mgr);
+  };
+  for (const auto &pair : _backend_contexts)
+  {
+    // builtin allocates temporary tensors of control flow kernels from its manager as well
+    if (auto builtin_context =
+          dynamic_cast<const backend::builtin::BackendContext *>(pair.second.get()))
+    {
+      add(builtin_context->tensor_builder->dynamicTensorManager()->dynamic_mem_mgr().get());
+      continue;
+    }
+    // Other backends with basic tensors hold the manager in each tensor
+    auto tensor_reg =
+      std::dynamic_pointer_cast<backend::basic::TensorRegistry>(pair.second->tensor_registry);
+    if (tensor_reg == nullptr)
+      continue;
+    for (const auto &tensor : tensor_reg->native_tensors())
+      add(tensor.second->dynamic_mem_mgr());
+  }
+  return mgrs;
+}
+
 void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs,
                            const std::vector<backend::IPortableTensor *> &outputs)
 {
@@ -29,6 +29,7 @@
 #include "ir/OperationIndexMap.h"
 #include "compiler/LoweredGraph.h"
 #include "compiler/TensorRegistries.h"
+#include "backend/basic/MemoryManager.h"
 #include "backend/builtin/IOTensor.h"
 #include "util/TracingCtx.h"
 
@@ -78,6 +79,11 @@ public:
     return _output_tensors;
   }
 
+  /**
+   * @brief Returns dynamic memory managers of the backends, to sum up their allocation counters
+   */
+  std::vector<const backend::basic::DynamicMemoryManager *> dynamicMemoryManagers() const;
+
 protected:
   /**
    * @brief Returns @c true if any input tensor is dynamic; @c false if all are static tensors
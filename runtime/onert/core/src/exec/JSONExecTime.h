@@ -53,6 +53,14 @@ public:
     }
     loadOperationsExecTime();
   };
+  /**
+   * @brief Construct with the same file and backends as other, without loading the file
+   */
+  JSON(const JSON &other, MeasurementData &measurements)
+    : _measurement_file(other._measurement_file), _backends(other._backends),
+      _measurements(measurements)
+  {
+  }
   /**
    * @brief Update _measurement_file with new data.
    */
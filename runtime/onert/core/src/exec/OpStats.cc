@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/OpStats.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace onert
+{
+namespace exec
+{
+
+void LatencyHistogram::reset()
+{
+  for (auto &bucket : _buckets)
+    bucket.store(0, std::memory_order_relaxed);
+  _count.store(0, std::memory_order_relaxed);
+  _sum.store(0, std::memory_order_relaxed);
+  _max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::percentile(double ratio) const
+{
+  assert(ratio >= 0 && ratio <= 1);
+
+  // Counts are read one by one while other threads may add samples, so use the sum of them
+  std::array<uint64_t, NUM_BUCKETS> counts;
+  uint64_t total = 0;
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    counts[i] = _buckets[i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+  if (total == 0)
+    return 0;
+
+  const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(ratio * total)));
+  uint64_t seen = 0;
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    seen += counts[i];
+    if (seen >= rank)
+      return std::min(bucketUpperBound(i), max());
+  }
+  return max();
+}
+
+uint32_t LatencyHistogram::bucketOf(uint64_t ns)
+{
+  // Values below SUB_BUCKETS have their own buckets
+  if (ns < SUB_BUCKETS)
+    return static_cast<uint32_t>(ns);
+
+  uint32_t msb = 63;
+  while ((ns >> msb) == 0)
+    --msb;
+  if (msb > MAX_BITS)
+    return NUM_BUCKETS - 1;
+
+  // SUB_BUCKET_BITS bits below the most significant bit select a sub bucket
+  const auto sub = static_cast<uint32_t>(ns >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+  return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(uint32_t bucket)
+{
+  assert(bucket < NUM_BUCKETS);
+  if (bucket < SUB_BUCKETS)
+    return bucket;
+
+  const uint32_t msb = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+  const uint64_t sub = bucket % SUB_BUCKETS;
+  return ((SUB_BUCKETS + sub + 1) << (msb - SUB_BUCKET_BITS)) - 1;
+}
+
+OpStats::Entry &OpStats::entry(ir::SubgraphIndex subg_index, ir::OperationIndex op_index,
+                               const std::string &name, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto &entry = _entries[std::make_pair(subg_index.value(), op_index.value())];
+  if (!entry)
+  {
+    entry = std::make_unique<Entry>();
+    entry->subg_index = subg_index;
+    entry->op_index = op_index;
+    entry->name = name;
+    entry->bytes = bytes;
+  }
+  return *entry;
+}
+
+std::vector<const OpStats::Entry *> OpStats::entries() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  std::vector<const Entry *> entries;
+  for (const auto &pair : _entries)
+    entries.emplace_back(pair.second.get());
+  return entries;
+}
+
+void OpStats::reset()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  for (auto &pair : _entries)
+    pair.second->latency.reset();
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/OpStats.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace onert;
+using namespace onert::exec;
+
+TEST(LatencyHistogram, bucket_bounds)
+{
+  // Buckets are contiguous and an upper bound belongs to its bucket
+  for (uint32_t b = 0; b + 1 < LatencyHistogram::NUM_BUCKETS; ++b)
+  {
+    const auto upper = LatencyHistogram::bucketUpperBound(b);
+    ASSERT_EQ(LatencyHistogram::bucketOf(upper), b);
+    ASSERT_EQ(LatencyHistogram::bucketOf(upper + 1), b + 1);
+  }
+  ASSERT_EQ(LatencyHistogram::bucketOf(UINT64_MAX), LatencyHistogram::NUM_BUCKETS - 1);
+}
+
+TEST(LatencyHistogram, percentile)
+{
+  LatencyHistogram hist;
+  ASSERT_EQ(hist.percentile(0.5), 0);
+
+  for (uint64_t ns = 1; ns <= 1000; ++ns)
+    hist.add(ns * 1000);
+
+  ASSERT_EQ(hist.count(), 1000);
+  ASSERT_EQ(hist.max(), 1000000);
+  ASSERT_EQ(hist.sum(), 500500000);
+
+  // Within the bucket resolution
+  const auto p50 = hist.percentile(0.5);
+  const auto p99 = hist.percentile(0.99);
+  ASSERT_GE(p50, 500000);
+  ASSERT_LE(p50, 500000 * 5 / 4);
+  ASSERT_GE(p99, 990000);
+  ASSERT_LE(p99, 1000000);
+  ASSERT_EQ(hist.percentile(1), 1000000);
+
+  hist.reset();
+  ASSERT_EQ(hist.count(), 0);
+  ASSERT_EQ(hist.percentile(0.99), 0);
+}
+
+TEST(LatencyHistogram, concurrent_add)
+{
+  LatencyHistogram hist;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&hist, t]() {
+      for (int i = 0; i < 10000; ++i)
+        hist.add(100 * (t + 1));
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  ASSERT_EQ(hist.count(), 40000);
+  ASSERT_EQ(hist.max(), 400);
+  ASSERT_EQ(hist.sum(), 10000 * (100 + 200 + 300 + 400));
+}
+
+TEST(OpStats, entries)
+{
+  OpStats stats;
+  auto &subg = stats.entry(ir::SubgraphIndex{0}, ir::OperationIndex{}, "Subgraph", 0);
+  auto &op1 = stats.entry(ir::SubgraphIndex{0}, ir::OperationIndex{1}, "Add", 12);
+  auto &op0 = stats.entry(ir::SubgraphIndex{0}, ir::OperationIndex{0}, "Conv2D", 100);
+
+  // Same entry for the same operation
+  ASSERT_EQ(&stats.entry(ir::SubgraphIndex{0}, ir::OperationIndex{1}, "Add", 12), &op1);
+
+  op0.latency.add(10);
+  op1.latency.add(20);
+  subg.latency.add(30);
+
+  auto entries = stats.entries();
+  ASSERT_EQ(entries.size(), 3);
+  ASSERT_EQ(entries[0], &op0);
+  ASSERT_EQ(entries[1], &op1);
+  ASSERT_EQ(entries[2], &subg);
+
+  stats.reset();
+  for (auto entry : stats.entries())
+    ASSERT_EQ(entry->latency.count(), 0);
+}
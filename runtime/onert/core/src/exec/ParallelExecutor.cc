@@ -51,37 +51,73 @@ private:
 
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
-  std::unique_lock<std::mutex> lock{_mu_jobs};
-
-  DataflowExecutor::notify(finished_job_id);
-
-  lock.unlock();
-  _cv_jobs.notify_all();
+  for (auto id : _output_info[finished_job_id])
+  {
+    auto count = --_num_pending_inputs[id];
+    if (count == 0) // No dependent jobs left, ready for execution
+    {
+      assignJob(id);
+    }
+  }
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                                    backend::BackendContexts &&backend_contexts,
                                    const compiler::TensorRegistries &tensor_regs,
                                    compiler::CodeMap &&code_map,
-                                   const util::TracingCtx *tracing_ctx)
+                                   const util::TracingCtx *tracing_ctx,
+                                   const std::unordered_map<std::string, uint32_t> &num_threads)
   : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
                      std::move(code_map), tracing_ctx}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
-
-void ParallelExecutor::executeImpl()
-{
-  bool dynamic_input_exists = hasDynamicInput();
 
-  // Init scheduler
+  // Init scheduler, whose worker threads are reused by every run
   // TODO Consider to have distinct backend set in GraphLowerInfo
   BackendSet backends;
   _lowered_graph->lower_info().operation.iterate(
     [&](const ir::OperationIndex &, const compiler::OperationLowerInfo &lower_info) {
       backends.add(lower_info.backend());
     });
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_threads);
+
+  _num_pending_inputs = std::vector<std::atomic<uint32_t>>(_initial_input_info.size());
+}
+
+void ParallelExecutor::assignJob(uint32_t job_index)
+{
+  auto &job = _waiting_jobs[job_index];
+  assert(job != nullptr);
+
+  VERBOSE(ParallelExecutor) << "Assigning fn " << job_index << std::endl;
+
+  // NOTE This is called by multiple worker threads, so do not use non-const accessors
+  auto op_ind = _job_to_op.at(job_index);
+  auto backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
+  auto setup = [&, op_ind, backend]() {
+    _subject.notifyJobBegin(this, _profiling_subg_index, op_ind, backend);
+  };
+  auto teardown = [&, job_index, op_ind, backend]() {
+    _subject.notifyJobEnd(this, _profiling_subg_index, op_ind, backend);
+    notify(job_index);
+  };
+
+  job->fn_seq()->initRunning();
+
+  // dynamic tensor setting
+  bool handle_dynamic_tensor =
+    _lowered_graph->getHasDynamicTensor(op_ind) || _dynamic_input_exists;
+  job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
+
+  auto fn = std::make_unique<HookFunction>(job->fn_seq(), setup, teardown);
+  auto rank = calculateRank({op_ind});
+  _finished_jobs[job_index] = std::move(job);
+  _scheduler->assign(std::move(fn), backend, rank);
+}
+
+void ParallelExecutor::executeImpl()
+{
+  _dynamic_input_exists = hasDynamicInput();
 
   assert(noWaitingJobs());
 
@@ -90,71 +126,33 @@ void ParallelExecutor::executeImpl()
 
   for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
-    {
-      emplaceToReadyJobs(i);
-    }
+    _num_pending_inputs[i] = _initial_input_info[i];
   }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
 
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+  _profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
-  auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+  _subject.notifySubgraphBegin(_profiling_subg_index);
 
-  _subject.notifySubgraphBegin(profiling_subg_index);
-
-  while (true)
+  // Assign initial jobs, then the others are assigned by the workers as they become ready
+  uint32_t num_initial_jobs = 0;
+  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
-
-    if (_ready_jobs.empty())
+    VERBOSE(ParallelExecutor) << i << ": " << _initial_input_info[i] << std::endl;
+    if (_initial_input_info[i] == 0)
     {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
+      assignJob(i);
+      ++num_initial_jobs;
     }
-
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
-
-    lock.unlock();
-
-    VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
-
-    auto job_index = job->index();
-    auto op_ind = _job_to_op[job_index];
-    auto backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
-    auto setup = [&, op_ind, backend]() {
-      _subject.notifyJobBegin(this, profiling_subg_index, op_ind, backend);
-    };
-    auto teardown = [&, job_index, op_ind, backend]() {
-      _subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
-      notify(job_index);
-    };
-
-    job->fn_seq()->initRunning();
-
-    // dynamic tensor setting
-    bool handle_dynamic_tensor =
-      _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
-    job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
-
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
-    _finished_jobs[job_index] = std::move(job);
   }
+  assert(num_initial_jobs > 0); // Cannot begin if there is no initial jobs
 
-  assert(noWaitingJobs());
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << num_initial_jobs << std::endl;
 
   // Wait for all the jobs done
   _scheduler->finish();
-  _subject.notifySubgraphEnd(profiling_subg_index);
+  assert(noWaitingJobs());
 
-  // Reset input info for the next execution
-  _input_info = _initial_input_info;
+  _subject.notifySubgraphEnd(_profiling_subg_index);
 }
 
 } // namespace exec
@@ -17,6 +17,7 @@
 #ifndef __ONERT_EXEC_PARALLEL_EXECUTOR_H__
 #define __ONERT_EXEC_PARALLEL_EXECUTOR_H__
 
+#include <atomic>
 #include <list>
 #include <queue>
 #include <unordered_map>
@@ -37,6 +38,9 @@ namespace exec
 
 /**
  * @brief Class to execute Graph in parallel
+ *
+ * There is no dispatcher thread. Jobs that become ready are assigned to the scheduler by the
+ * worker which finished their last dependency.
  */
 class ParallelExecutor : public DataflowExecutor
 {
@@ -50,18 +54,28 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param num_threads Number of worker threads for each backend id
    */
   ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                    backend::BackendContexts &&backend_contexts,
                    const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                   const util::TracingCtx *tracing_ctx);
+                   const util::TracingCtx *tracing_ctx,
+                   const std::unordered_map<std::string, uint32_t> &num_threads = {});
 
   void executeImpl() override;
 
 private:
-  std::condition_variable _cv_jobs;
-  std::mutex _mu_jobs;
+  void assignJob(uint32_t job_index);
+
+private:
   std::unique_ptr<ParallelScheduler> _scheduler;
+  /**
+   * @brief Number of unfinished dependencies of each job for current execution
+   *        Shared by worker threads, so it is used instead of #_input_info
+   */
+  std::vector<std::atomic<uint32_t>> _num_pending_inputs;
+  bool _dynamic_input_exists{false};
+  ir::SubgraphIndex _profiling_subg_index;
 };
 
 } // namespace exec
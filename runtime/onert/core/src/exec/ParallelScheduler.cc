@@ -18,37 +18,88 @@
 
 #include <cassert>
 
+#include <functional>
 #include <memory>
+#include "backend/Backend.h"
 #include "util/logging.h"
 
+namespace
+{
+
+using namespace onert;
+
+class CountDownFunction : public exec::IFunction
+{
+public:
+  CountDownFunction(std::unique_ptr<exec::IFunction> &&fn, const std::function<void()> &count_down)
+    : _fn{std::move(fn)}, _count_down{count_down}
+  {
+  }
+
+public:
+  void run() override
+  {
+    _fn->run();
+    _count_down();
+  }
+
+private:
+  std::unique_ptr<exec::IFunction> _fn;
+  std::function<void()> _count_down;
+};
+
+} // namespace
+
 namespace onert
 {
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends,
+                                     const std::unordered_map<std::string, uint32_t> &num_threads)
 {
   assert(!backends.empty());
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    uint32_t backend_num_threads = 1;
+    auto found = num_threads.find(backend->config()->id());
+    if (found != num_threads.end())
+      backend_num_threads = found->second;
+
+    VERBOSE(ParallelScheduler) << "Create " << backend_num_threads << " thread(s) for backend "
+                               << backend->config()->id() << std::endl;
+    _thread_pools[backend] = std::make_unique<ThreadPool>(backend_num_threads);
   }
 }
 
-void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend)
+void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend,
+                               int64_t priority)
 {
   assert(!_thread_pools.empty());
 
-  _thread_pools.at(backend)->enqueue(std::move(fn));
+  {
+    std::lock_guard<std::mutex> lock{_mu_pending};
+    ++_num_pending_jobs;
+  }
+
+  _thread_pools.at(backend)->enqueue(
+    std::make_unique<CountDownFunction>(std::move(fn), [this]() { countDown(); }), priority);
 }
 
 void ParallelScheduler::finish()
 {
-  for (auto &itr : _thread_pools)
-  {
-    itr.second->finish();
-  }
+  std::unique_lock<std::mutex> lock{_mu_pending};
+  _cv_pending.wait(lock, [this] { return _num_pending_jobs == 0; });
+}
+
+void ParallelScheduler::countDown()
+{
+  // NOTE Notify with the lock held, as the waiting thread may destroy this right after waking up
+  std::lock_guard<std::mutex> lock{_mu_pending};
+  assert(_num_pending_jobs > 0);
+  --_num_pending_jobs;
+  _cv_pending.notify_all();
 }
 
 } // namespace exec
@@ -17,8 +17,11 @@
 #ifndef __ONERT_EXEC_PARALLEL_SCHEDULER_H__
 #define __ONERT_EXEC_PARALLEL_SCHEDULER_H__
 
-#include <unordered_map>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "exec/IFunction.h"
 #include "BackendSet.h"
@@ -35,23 +38,39 @@ public:
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * Worker threads are created here and kept alive until the scheduler is destroyed, so that
+   * the same threads are reused over multiple runs.
+   *
+   * @param backends    Backend set
+   * @param num_threads Number of worker threads for each backend id, 1 if not given
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends,
+                    const std::unordered_map<std::string, uint32_t> &num_threads = {});
   /**
    * @brief Assign a task to the given backend
    *
-   * @param[in] fn Function to be assigned
-   * @param[in] fn Target backend
+   * @param[in] fn       Function to be assigned
+   * @param[in] backend  Target backend
+   * @param[in] priority Priority of the function, higher one runs first
    */
-  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
+  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend,
+              int64_t priority = 0);
   /**
-   * @brief Block until all jobs are finished
+   * @brief Block until all the assigned jobs are finished
+   *
+   * @note  Worker threads are not joined, so the scheduler can be used again after this
    */
   void finish();
 
+private:
+  void countDown();
+
 private:
   std::unordered_map<const backend::Backend *, std::unique_ptr<ThreadPool>> _thread_pools;
+  // Latch for the jobs assigned but not finished yet
+  uint32_t _num_pending_jobs{0};
+  std::mutex _mu_pending;
+  std::condition_variable _cv_pending;
 };
 
 } // namespace exec
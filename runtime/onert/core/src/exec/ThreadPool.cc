@@ -18,6 +18,15 @@
 
 #include <cassert>
 
+namespace
+{
+
+// The pool and the worker index of the current thread, if it is a worker thread
+thread_local const onert::exec::ThreadPool *tls_pool = nullptr;
+thread_local uint32_t tls_worker_index = 0;
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -29,36 +38,113 @@ ThreadPool::ThreadPool(uint32_t num_threads)
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _workers.emplace_back(std::make_unique<Worker>());
+  }
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back([this, i]() { work(i); });
   }
 }
 
 ThreadPool::~ThreadPool()
 {
-  if (!_threads.empty())
   {
-    _worker.terminate();
-    join();
+    std::lock_guard<std::mutex> lock{_mu_sleep};
+    _terminating = true;
+  }
+  _cv_sleep.notify_all();
+
+  for (auto &thread : _threads)
+  {
+    thread.join();
   }
+  assert(_num_queued == 0 && "Terminating with unfinished jobs");
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn, int64_t priority)
+{
+  // Keep the job on the current worker if it is enqueued by a job of this pool, otherwise
+  // distribute jobs over the workers
+  uint32_t worker_index = (tls_pool == this) ? tls_worker_index
+                                             : _next_worker.fetch_add(1) % _workers.size();
+  {
+    auto &worker = *_workers[worker_index];
+    std::lock_guard<std::mutex> lock{worker.mu};
+    worker.functions.emplace(priority, std::move(fn));
+  }
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+  // NOTE A worker increases _num_sleeping before it checks _num_queued, and this increases
+  //      _num_queued before it checks _num_sleeping. So either the worker sees this job or this
+  //      wakes the worker up.
+  ++_num_queued;
+  if (_num_sleeping > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mu_sleep};
+    }
+    _cv_sleep.notify_one();
+  }
+}
 
-void ThreadPool::join()
+uint32_t ThreadPool::numJobsInQueue() { return _num_queued; }
+
+void ThreadPool::work(uint32_t worker_index)
 {
-  for (auto &thread : _threads)
+  tls_pool = this;
+  tls_worker_index = worker_index;
+
+  while (true)
   {
-    thread.join();
+    auto fn = pop(worker_index);
+    if (!fn)
+      fn = steal(worker_index);
+
+    if (fn)
+    {
+      fn->run();
+      continue;
+    }
+
+    if (_terminating)
+      break;
+
+    waitForJobs();
+  }
+
+  tls_pool = nullptr;
+}
+
+std::unique_ptr<IFunction> ThreadPool::pop(uint32_t worker_index)
+{
+  auto &worker = *_workers[worker_index];
+  std::lock_guard<std::mutex> lock{worker.mu};
+  if (worker.functions.empty())
+    return nullptr;
+
+  auto fn = std::move(worker.functions.begin()->second);
+  worker.functions.erase(worker.functions.begin());
+  --_num_queued;
+  return fn;
+}
+
+std::unique_ptr<IFunction> ThreadPool::steal(uint32_t worker_index)
+{
+  const auto num_workers = static_cast<uint32_t>(_workers.size());
+  for (uint32_t i = 1; i < num_workers; ++i)
+  {
+    auto fn = pop((worker_index + i) % num_workers);
+    if (fn)
+      return fn;
   }
-  _threads.clear();
+  return nullptr;
 }
 
-void ThreadPool::finish()
+void ThreadPool::waitForJobs()
 {
-  _worker.finish();
-  join();
+  std::unique_lock<std::mutex> lock{_mu_sleep};
+  ++_num_sleeping;
+  _cv_sleep.wait(lock, [this] { return _num_queued > 0 || _terminating; });
+  --_num_sleeping;
 }
 
 } // namespace exec
@@ -17,17 +17,30 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
-#include "WorkQueue.h"
+#include "exec/IFunction.h"
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Thread pool whose workers have their own ready queues
+ *
+ * Each worker takes the function of the highest priority from its own queue. When its queue is
+ * empty, it steals one from the queues of the other workers. A function enqueued from a worker
+ * of this pool goes to the queue of that worker, so that a job started by another job runs on
+ * the same thread unless some other worker is idle.
+ */
 class ThreadPool
 {
 public:
@@ -44,27 +57,39 @@ public:
   /**
    * @brief Enqueue a function
    *
-   * @param fn A function to be queued
+   * @param fn       A function to be queued
+   * @param priority Priority of the function, higher one runs first
    */
-  void enqueue(std::unique_ptr<IFunction> &&fn);
+  void enqueue(std::unique_ptr<IFunction> &&fn, int64_t priority = 0);
   /**
-   * @brief Get number of jobs in worker's queue
+   * @brief Get number of jobs in workers' queues
    *
    * @return Number of jobs
    */
   uint32_t numJobsInQueue();
 
-  /**
-   * @brief Block until all jobs are finished
-   */
-  void finish();
+private:
+  struct Worker
+  {
+    std::mutex mu;
+    std::multimap<int64_t, std::unique_ptr<IFunction>, std::greater<int64_t>> functions;
+  };
 
 private:
-  void join();
+  void work(uint32_t worker_index);
+  std::unique_ptr<IFunction> pop(uint32_t worker_index);
+  std::unique_ptr<IFunction> steal(uint32_t worker_index);
+  void waitForJobs();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<Worker>> _workers;
   std::vector<std::thread> _threads;
+  std::atomic<uint32_t> _num_queued{0};
+  std::atomic<uint32_t> _num_sleeping{0};
+  std::atomic<uint32_t> _next_worker{0};
+  std::atomic<bool> _terminating{false};
+  std::mutex _mu_sleep;
+  std::condition_variable _cv_sleep;
 };
 
 } // namespace exec
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/Subgraphs.h"
+
+#include "ir/Graph.h"
+
+namespace onert
+{
+namespace ir
+{
+
+std::shared_ptr<Subgraphs> Subgraphs::clone() const
+{
+  // Operands are copied with the shared pointers of their data, so constants are not copied
+  auto subgs = std::make_shared<Subgraphs>();
+  for (const auto &e : _subgraphs)
+    subgs->push(e.first, std::make_shared<Graph>(*e.second));
+  return subgs;
+}
+
+} // namespace ir
+} // namespace onert
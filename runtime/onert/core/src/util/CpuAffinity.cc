@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/CpuAffinity.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace
+{
+
+uint32_t toCpuId(const std::string &str)
+{
+  if (str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+    throw std::invalid_argument{"Invalid CPU id '" + str + "'"};
+  return static_cast<uint32_t>(std::stoul(str));
+}
+
+#ifdef __linux__
+bool getAffinity(std::vector<uint32_t> &cpus)
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0)
+    return false;
+
+  cpus.clear();
+  for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+  {
+    if (CPU_ISSET(cpu, &set))
+      cpus.push_back(cpu);
+  }
+  return true;
+}
+#endif
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+std::vector<uint32_t> parseCpuList(const std::string &str)
+{
+  std::vector<uint32_t> cpus;
+  if (str.empty())
+    return cpus;
+
+  std::stringstream ss{str};
+  std::string item;
+  while (std::getline(ss, item, ','))
+  {
+    const auto dash = item.find('-');
+    if (dash == std::string::npos)
+    {
+      cpus.push_back(toCpuId(item));
+      continue;
+    }
+
+    const auto first = toCpuId(item.substr(0, dash));
+    const auto last = toCpuId(item.substr(dash + 1));
+    if (first > last)
+      throw std::invalid_argument{"Invalid CPU range '" + item + "'"};
+    for (auto cpu = first; cpu <= last; ++cpu)
+      cpus.push_back(cpu);
+  }
+  if (str.back() == ',')
+    throw std::invalid_argument{"Invalid CPU list '" + str + "'"};
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::vector<std::vector<uint32_t>> splitCpuList(const std::vector<uint32_t> &cpus, size_t parts)
+{
+  std::vector<std::vector<uint32_t>> lists(parts);
+  for (size_t i = 0; i < parts; ++i)
+  {
+    if (cpus.size() < parts)
+    {
+      lists[i] = cpus;
+      continue;
+    }
+    const auto begin = cpus.begin() + cpus.size() * i / parts;
+    const auto end = cpus.begin() + cpus.size() * (i + 1) / parts;
+    lists[i].assign(begin, end);
+  }
+  return lists;
+}
+
+bool setThreadAffinity(const std::vector<uint32_t> &cpus)
+{
+  if (cpus.empty())
+    return true;
+
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : cpus)
+  {
+    if (cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) == 0)
+    return true;
+#endif
+
+  VERBOSE(CpuAffinity) << "Failed to bind the thread to the given CPUs" << std::endl;
+  return false;
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const std::vector<uint32_t> &cpus) : _changed{false}
+{
+  if (cpus.empty())
+    return;
+
+#ifdef __linux__
+  if (getAffinity(_prev_cpus))
+    _changed = setThreadAffinity(cpus);
+#endif
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity()
+{
+  if (_changed)
+    setThreadAffinity(_prev_cpus);
+}
+
+} // namespace util
+} // namespace onert
@@ -16,23 +16,9 @@
 
 #include "util/EventCollector.h"
 
-// C++ standard libraries
-#include <chrono>
-
-// POSIX standard libraries
-#include <sys/time.h>
-#include <sys/resource.h>
-
 namespace
 {
 
-std::string timestamp(void)
-{
-  auto now = std::chrono::steady_clock::now();
-  return std::to_string(
-    std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
-}
-
 class DurationEventBuilder : public EventCollector::EventVisitor
 {
 public:
@@ -92,43 +78,11 @@ private:
   std::string _ts;
 };
 
-#ifdef DEBUG
-inline void emit_rusage(EventRecorder *rec, const std::string &ts)
-{
-  struct rusage ru;
-
-  getrusage(RUSAGE_SELF, &ru);
-  {
-    CounterEvent evt;
-
-    evt.name = "maxrss";
-    evt.ph = "C";
-    evt.ts = ts;
-    evt.values["value"] = std::to_string(ru.ru_maxrss);
-
-    rec->emit(evt);
-  }
-
-  {
-    CounterEvent evt;
-
-    evt.name = "minflt";
-    evt.ph = "C";
-    evt.ts = ts;
-    evt.values["value"] = std::to_string(ru.ru_minflt);
-
-    rec->emit(evt);
-  }
-}
-#endif
-
 } // namespace
 
-template <typename EventT> void EventCollector::onEvent(const EventT &event)
+template <typename EventT> void EventCollector::onEvent(const EventT &event, uint64_t ts)
 {
-  auto ts = timestamp();
-
-  DurationEventBuilder builder(ts);
+  DurationEventBuilder builder(std::to_string(ts));
 
   switch (event.edge)
   {
@@ -145,14 +99,22 @@ template <typename EventT> void EventCollector::onEvent(const EventT &event)
       break;
     }
   }
+}
+
+void EventCollector::onCounter(const std::string &name, uint64_t value, uint64_t ts)
+{
+  CounterEvent evt;
+
+  evt.name = name;
+  evt.ph = "C";
+  evt.ts = std::to_string(ts);
+  evt.values["value"] = std::to_string(value);
 
-// TODO: Add resurece measurement(e.g. RSS)
-// when ready with low overhead in release build
-#ifdef DEBUG
-  emit_rusage(_rec, ts);
-#endif
+  _rec->emit(evt);
 }
 
 // template instantiation
-template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event);
-template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event);
+template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event,
+                                                                 uint64_t ts);
+template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event,
+                                                                  uint64_t ts);
@@ -105,7 +105,19 @@ public:
   }
 
 public:
-  template <typename EventT> void onEvent(const EventT &event);
+  /**
+   * @brief Build a duration event of the event and emit it to the recorder
+   *
+   * @param ts Timestamp of the event in microseconds
+   */
+  template <typename EventT> void onEvent(const EventT &event, uint64_t ts);
+
+  /**
+   * @brief Emit a counter event to the recorder
+   *
+   * @param ts Timestamp of the value in microseconds
+   */
+  void onCounter(const std::string &name, uint64_t value, uint64_t ts);
 
 protected:
   EventRecorder *_rec;
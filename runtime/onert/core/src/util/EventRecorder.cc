@@ -16,6 +16,23 @@
 
 #include "util/EventRecorder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
+namespace
+{
+
+std::atomic<uint64_t> next_recorder_id{1};
+
+} // namespace
+
+EventRecorder::EventRecorder(size_t trace_capacity)
+  : _id{next_recorder_id++}, _trace_capacity{std::max<size_t>(trace_capacity, 1)}
+{
+  // DO NOTHING
+}
+
 void EventRecorder::emit(std::unique_ptr<DurationEvent> &&evt)
 {
   std::lock_guard<std::mutex> lock{_mu};
@@ -29,3 +46,72 @@ void EventRecorder::emit(const CounterEvent &evt)
 
   _counter_events.push_back(evt);
 }
+
+EventRecorder::Ring &EventRecorder::newLocalRing()
+{
+  // Rings of this thread for each recorder, used when a thread records to several recorders
+  // alternately, e.g. executors of a subgraph and its nested subgraphs
+  thread_local std::unordered_map<uint64_t, std::weak_ptr<Ring>> local_rings;
+
+  auto it = local_rings.find(_id);
+  if (it != local_rings.end())
+    return *it->second.lock();
+
+  // Forget rings of destroyed recorders, so that a long-lived thread does not keep an entry for
+  // every recorder it has ever recorded to
+  for (auto it = local_rings.begin(); it != local_rings.end();)
+  {
+    if (it->second.expired())
+      it = local_rings.erase(it);
+    else
+      ++it;
+  }
+
+  std::lock_guard<std::mutex> lock{_mu};
+
+  _rings.emplace_back(std::make_shared<Ring>(_trace_capacity));
+  auto ring = _rings.back();
+  local_rings.emplace(_id, ring);
+  return *ring;
+}
+
+std::vector<TraceEvent> EventRecorder::trace_events() const
+{
+  // Events before this may have been overwritten in some ring
+  uint64_t valid_from = 0;
+  for (const auto &ring : _rings)
+  {
+    const auto capacity = ring->events.size();
+    if (ring->count > capacity)
+      valid_from = std::max(valid_from, ring->events[ring->count % capacity].ts);
+  }
+
+  std::vector<TraceEvent> events;
+  for (const auto &ring : _rings)
+  {
+    const auto capacity = ring->events.size();
+    const auto begin = ring->count > capacity ? ring->count - capacity : 0;
+    for (auto i = begin; i < ring->count; ++i)
+    {
+      const auto &evt = ring->events[i % capacity];
+      if (evt.ts >= valid_from)
+        events.push_back(evt);
+    }
+  }
+
+  std::stable_sort(events.begin(), events.end(),
+                   [](const TraceEvent &lhs, const TraceEvent &rhs) { return lhs.ts < rhs.ts; });
+  return events;
+}
+
+uint64_t EventRecorder::dropped_trace_events() const
+{
+  uint64_t dropped = 0;
+  for (const auto &ring : _rings)
+  {
+    const auto capacity = ring->events.size();
+    if (ring->count > capacity)
+      dropped += ring->count - capacity;
+  }
+  return dropped;
+}
@@ -19,12 +19,21 @@
 
 #include "util/TracingCtx.h"
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
-
+#include <type_traits>
 #include <vector>
 
+namespace onert
+{
+namespace backend
+{
+class Backend;
+} // namespace backend
+} // namespace onert
+
 // refer to https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/edit#
 struct Event
 {
@@ -66,6 +75,50 @@ struct CounterEvent : public Event
   std::map<std::string, std::string> values;
 };
 
+/**
+ * @brief Fixed-size trace record written while a model runs
+ *
+ * Names, labels and timestamp strings are not built when recording. They are resolved from
+ * these records only when the trace is flushed.
+ */
+struct TraceEvent
+{
+  enum class Kind : uint8_t
+  {
+    SUBG,
+    OP,
+    COUNTER, // A counter value sampled with the preceding event of the same thread
+  };
+
+  enum class Edge : uint8_t
+  {
+    BEGIN,
+    END,
+  };
+
+  enum class Counter : uint8_t
+  {
+    DYNAMIC_ALLOC_CALLS,
+    DYNAMIC_ALLOC_BYTES,
+    DYNAMIC_HEAP_ALLOC_CALLS,
+    MAXRSS,
+    MINFLT,
+  };
+
+  uint64_t ts; // steady clock in nanoseconds
+  union {
+    const onert::backend::Backend *backend; // for OP
+    uint64_t value;                         // for COUNTER
+  };
+  uint32_t subg_index;
+  uint32_t op_index; // for OP
+  Kind kind;
+  Edge edge;       // for SUBG and OP
+  Counter counter; // for COUNTER
+};
+
+static_assert(std::is_trivially_copyable<TraceEvent>::value, "TraceEvent must be POD");
+
 //
 // Record Event as Chrome Trace Event File Format
 //
@@ -74,12 +127,47 @@ struct CounterEvent : public Event
 class EventRecorder
 {
 public:
-  EventRecorder() = default;
+  static constexpr size_t DEFAULT_TRACE_CAPACITY = 16384;
+
+public:
+  /**
+   * @param trace_capacity Number of TraceEvent kept per recording thread
+   */
+  explicit EventRecorder(size_t trace_capacity = DEFAULT_TRACE_CAPACITY);
 
 public:
   void emit(std::unique_ptr<DurationEvent> &&evt);
   void emit(const CounterEvent &evt);
 
+  /**
+   * @brief Record an event into the ring buffer of the calling thread
+   *
+   * @note  The buffer of a thread is allocated on its first call, and only that call takes a
+   *        lock. When the buffer is full, the oldest event of the thread is overwritten.
+   */
+  void record(const TraceEvent &evt)
+  {
+    auto &ring = localRing();
+    ring.events[ring.count % ring.events.size()] = evt;
+    ring.count++;
+  }
+
+  /**
+   * @brief Return recorded TraceEvents of all threads in timestamp order
+   *
+   * Events of a thread keep their recording order. If a ring buffer has wrapped around, events
+   * older than its oldest kept event are dropped from all threads, so that every thread covers
+   * the same period.
+   *
+   * @note  Call this only when no thread is recording
+   */
+  std::vector<TraceEvent> trace_events() const;
+
+  /**
+   * @brief Return the number of TraceEvents overwritten by ring buffers
+   */
+  uint64_t dropped_trace_events() const;
+
 public:
   const std::vector<std::unique_ptr<DurationEvent>> &duration_events() const
   {
@@ -88,6 +176,36 @@ public:
   const std::vector<CounterEvent> &counter_events() const { return _counter_events; }
 
 private:
+  struct Ring
+  {
+    explicit Ring(size_t capacity) : events(capacity), count(0) {}
+
+    std::vector<TraceEvent> events;
+    uint64_t count; // Total number of recorded events
+  };
+
+  Ring &localRing()
+  {
+    // Cache of the last used ring, which is the one of this recorder in most cases
+    thread_local uint64_t cached_id = 0;
+    thread_local Ring *cached_ring = nullptr;
+    if (cached_id != _id)
+    {
+      cached_ring = &newLocalRing();
+      cached_id = _id;
+    }
+    return *cached_ring;
+  }
+
+  Ring &newLocalRing();
+
+private:
+  // Unique id of this recorder, never reused so that rings cached by threads cannot be mixed up
+  const uint64_t _id;
+  const size_t _trace_capacity;
+  // Shared with weak references of recording threads, which see whether the recorder is alive
+  std::vector<std::shared_ptr<Ring>> _rings;
+
   std::mutex _mu;
   std::vector<std::unique_ptr<DurationEvent>> _duration_events;
   std::vector<CounterEvent> _counter_events;
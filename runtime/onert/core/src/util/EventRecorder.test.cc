@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EventRecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+
+TraceEvent makeEvent(uint64_t ts, uint32_t op_index)
+{
+  TraceEvent evt;
+  evt.ts = ts;
+  evt.backend = nullptr;
+  evt.subg_index = 0;
+  evt.op_index = op_index;
+  evt.kind = TraceEvent::Kind::OP;
+  evt.edge = TraceEvent::Edge::BEGIN;
+  return evt;
+}
+
+TEST(EventRecorder, trace_events_in_order)
+{
+  EventRecorder recorder{8};
+  recorder.record(makeEvent(10, 0));
+  recorder.record(makeEvent(30, 1));
+
+  std::thread t{[&]() { recorder.record(makeEvent(20, 2)); }};
+  t.join();
+
+  auto events = recorder.trace_events();
+  ASSERT_EQ(events.size(), 3);
+  ASSERT_EQ(events[0].op_index, 0);
+  ASSERT_EQ(events[1].op_index, 2);
+  ASSERT_EQ(events[2].op_index, 1);
+  ASSERT_EQ(recorder.dropped_trace_events(), 0);
+}
+
+TEST(EventRecorder, overwrite_oldest_events)
+{
+  EventRecorder recorder{4};
+  for (uint32_t i = 0; i < 10; ++i)
+    recorder.record(makeEvent(i * 10, i));
+
+  auto events = recorder.trace_events();
+  ASSERT_EQ(events.size(), 4);
+  for (uint32_t i = 0; i < 4; ++i)
+    ASSERT_EQ(events[i].op_index, 6 + i);
+  ASSERT_EQ(recorder.dropped_trace_events(), 6);
+}
+
+TEST(EventRecorder, drop_events_older_than_wrapped_ring)
+{
+  EventRecorder recorder{2};
+  // This thread keeps events of ts 0 ~ 40
+  recorder.record(makeEvent(0, 0));
+  recorder.record(makeEvent(40, 1));
+
+  // The other thread keeps events of ts 20 ~ 30 only
+  std::thread t{[&]() {
+    for (uint32_t i = 0; i < 4; ++i)
+      recorder.record(makeEvent(i * 10, 10 + i));
+  }};
+  t.join();
+
+  auto events = recorder.trace_events();
+  ASSERT_EQ(events.size(), 3);
+  ASSERT_EQ(events[0].op_index, 12);
+  ASSERT_EQ(events[1].op_index, 13);
+  ASSERT_EQ(events[2].op_index, 1);
+}
+
+TEST(EventRecorder, switch_recorders_in_a_thread)
+{
+  EventRecorder recorder1{4};
+  EventRecorder recorder2{4};
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    recorder1.record(makeEvent(i, i));
+    recorder2.record(makeEvent(i, 10 + i));
+  }
+
+  auto events1 = recorder1.trace_events();
+  auto events2 = recorder2.trace_events();
+  ASSERT_EQ(events1.size(), 3);
+  ASSERT_EQ(events2.size(), 3);
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    ASSERT_EQ(events1[i].op_index, i);
+    ASSERT_EQ(events2[i].op_index, 10 + i);
+  }
+}
+
+TEST(EventRecorder, outlive_recorders_destroyed_in_a_thread)
+{
+  EventRecorder recorder{4};
+  recorder.record(makeEvent(0, 0));
+  // Rings of destroyed recorders are forgotten by the thread while the live one is kept
+  for (uint32_t i = 1; i < 100; ++i)
+  {
+    EventRecorder temp{4};
+    temp.record(makeEvent(i, i));
+    ASSERT_EQ(temp.trace_events().size(), 1);
+    recorder.record(makeEvent(i, i));
+  }
+
+  auto events = recorder.trace_events();
+  ASSERT_EQ(events.size(), 4);
+  ASSERT_EQ(events[3].op_index, 99);
+  ASSERT_EQ(recorder.dropped_trace_events(), 96);
+}
+
+} // namespace
@@ -161,6 +161,14 @@ private:
   void loadUnpack(const Operator *op, ir::Graph &subg);
   void loadWhile(const Operator *op, ir::Graph &subg);
 
+  // Offset of data stored outside of the flatbuffer, 0 if the schema does not have the field
+  template <typename BufferT>
+  static auto bufferOffset(const BufferT *buffer, int) -> decltype(buffer->offset())
+  {
+    return buffer->offset();
+  }
+  template <typename BufferT> static uint64_t bufferOffset(const BufferT *, long) { return 0; }
+
   void verifySubgraphIndex(int subg_index)
   {
     const auto num_subgraphs = _model->subgraphs()->size();
@@ -336,7 +344,11 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   const auto operand_index = subg.addOperand(shape, type_info);
 
   // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
+  const auto *buffer = _model->buffers()->Get(tensor->buffer());
+  // Data outside of the flatbuffer is indicated by an offset larger than 1
+  if (bufferOffset(buffer, 0) > 1)
+    throw std::runtime_error("Buffer data outside of the flatbuffer is not supported");
+  const auto *data = buffer->data();
   if (data != nullptr)
   {
     using std::ptrdiff_t;
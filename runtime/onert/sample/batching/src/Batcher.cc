@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Batcher.h"
+
+#include "nnfw_internal.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+void check(NNFW_STATUS status, const std::string &what)
+{
+  if (status != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error{what + " failed with status " + std::to_string(status)};
+}
+
+bool isDirectory(const std::string &path)
+{
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+uint64_t bufsizeFor(const nnfw_tensorinfo &ti)
+{
+  static const uint64_t elmsize[] = {
+    sizeof(float),   /* NNFW_TYPE_TENSOR_FLOAT32 */
+    sizeof(int),     /* NNFW_TYPE_TENSOR_INT32 */
+    sizeof(uint8_t), /* NNFW_TYPE_TENSOR_QUANT8_ASYMM */
+    sizeof(bool),    /* NNFW_TYPE_TENSOR_BOOL = 3 */
+    sizeof(uint8_t), /* NNFW_TYPE_TENSOR_UINT8 = 4 */
+    sizeof(int64_t), /* NNFW_TYPE_TENSOR_INT64 = 5 */
+    sizeof(int8_t),  /* NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 6 */
+    sizeof(int16_t), /* NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED = 7 */
+  };
+  uint64_t n = 1;
+  for (int32_t i = 0; i < ti.rank; ++i)
+    n *= ti.dims[i];
+  return elmsize[ti.dtype] * n;
+}
+
+std::vector<uint32_t> bucketsFor(const batching::BatcherOptions &options)
+{
+  if (options.max_batch == 0)
+    throw std::invalid_argument{"max_batch must be positive"};
+
+  auto buckets = options.buckets;
+  if (buckets.empty())
+  {
+    for (uint32_t batch = 1; batch < options.max_batch; batch *= 2)
+      buckets.emplace_back(batch);
+  }
+  if (std::find(buckets.begin(), buckets.end(), 0) != buckets.end())
+    throw std::invalid_argument{"Bucket must be positive"};
+
+  // A batch of max_batch requests must fit in a bucket
+  buckets.emplace_back(options.max_batch);
+  std::sort(buckets.begin(), buckets.end());
+  buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+  buckets.erase(std::upper_bound(buckets.begin(), buckets.end(), options.max_batch),
+                buckets.end());
+  return buckets;
+}
+
+} // namespace
+
+namespace batching
+{
+
+Batcher::Batcher(const std::string &model_path, const BatcherOptions &options)
+  : _options{options}
+{
+  try
+  {
+    for (auto batch : bucketsFor(_options))
+    {
+      _buckets.emplace_back(std::make_unique<Bucket>());
+      _buckets.back()->batch = batch;
+      prepareBucket(*_buckets.back(), model_path);
+    }
+  }
+  catch (...)
+  {
+    for (auto &bucket : _buckets)
+      nnfw_close_session(bucket->session);
+    throw;
+  }
+
+  _worker = std::thread{[this]() { work(); }};
+}
+
+Batcher::~Batcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _cv.notify_one();
+  _worker.join();
+
+  for (auto &bucket : _buckets)
+    nnfw_close_session(bucket->session);
+}
+
+void Batcher::prepareBucket(Bucket &bucket, const std::string &model_path)
+{
+  // NOTE Sessions cannot share a loaded model, so each bucket loads its own copy
+  check(nnfw_create_session(&bucket.session), "nnfw_create_session");
+  if (isDirectory(model_path))
+    check(nnfw_load_model_from_file(bucket.session, model_path.c_str()), "Loading " + model_path);
+  else
+    check(nnfw_load_model_from_modelfile(bucket.session, model_path.c_str()),
+          "Loading " + model_path);
+  if (!_options.backends.empty())
+    check(nnfw_set_available_backends(bucket.session, _options.backends.c_str()),
+          "nnfw_set_available_backends");
+
+  uint32_t num_inputs = 0;
+  check(nnfw_input_size(bucket.session, &num_inputs), "nnfw_input_size");
+  for (uint32_t i = 0; i < num_inputs; ++i)
+  {
+    nnfw_tensorinfo ti;
+    check(nnfw_input_tensorinfo(bucket.session, i, &ti), "nnfw_input_tensorinfo");
+    if (ti.rank < 1 || ti.dims[0] != 1)
+      throw std::runtime_error{"Input " + std::to_string(i) + " does not have batch size 1"};
+    // Set the shape before preparing, so that it is static and memory is planned for it
+    ti.dims[0] = static_cast<int32_t>(bucket.batch);
+    check(nnfw_set_input_tensorinfo(bucket.session, i, &ti), "nnfw_set_input_tensorinfo");
+  }
+
+  check(nnfw_prepare(bucket.session), "nnfw_prepare");
+
+  // Buffers are bound once, and requests are copied in and out of them
+  std::vector<size_t> input_bytes;
+  for (uint32_t i = 0; i < num_inputs; ++i)
+  {
+    nnfw_tensorinfo ti;
+    check(nnfw_input_tensorinfo(bucket.session, i, &ti), "nnfw_input_tensorinfo");
+    bucket.inputs.emplace_back(bufsizeFor(ti));
+    auto &buf = bucket.inputs.back();
+    check(nnfw_set_input(bucket.session, i, ti.dtype, buf.data(), buf.size()), "nnfw_set_input");
+    input_bytes.emplace_back(buf.size() / bucket.batch);
+  }
+
+  uint32_t num_outputs = 0;
+  check(nnfw_output_size(bucket.session, &num_outputs), "nnfw_output_size");
+  std::vector<size_t> output_bytes;
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    nnfw_tensorinfo ti;
+    check(nnfw_output_tensorinfo(bucket.session, i, &ti), "nnfw_output_tensorinfo");
+    if (ti.rank < 1 || ti.dims[0] != static_cast<int32_t>(bucket.batch))
+      throw std::runtime_error{"Output " + std::to_string(i) + " does not follow batch size"};
+    bucket.outputs.emplace_back(bufsizeFor(ti));
+    auto &buf = bucket.outputs.back();
+    check(nnfw_set_output(bucket.session, i, ti.dtype, buf.data(), buf.size()),
+          "nnfw_set_output");
+    output_bytes.emplace_back(buf.size() / bucket.batch);
+  }
+
+  if (_input_bytes.empty() && _output_bytes.empty())
+  {
+    _input_bytes = std::move(input_bytes);
+    _output_bytes = std::move(output_bytes);
+  }
+  else if (_input_bytes != input_bytes || _output_bytes != output_bytes)
+  {
+    throw std::runtime_error{"Sample size differs with batch size " +
+                             std::to_string(bucket.batch)};
+  }
+}
+
+std::future<void> Batcher::submit(std::vector<const void *> inputs, std::vector<void *> outputs)
+{
+  if (inputs.size() != _input_bytes.size() || outputs.size() != _output_bytes.size())
+    throw std::invalid_argument{"Wrong number of inputs or outputs"};
+
+  Request request;
+  request.inputs = std::move(inputs);
+  request.outputs = std::move(outputs);
+  request.arrival = std::chrono::steady_clock::now();
+  auto future = request.done.get_future();
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_stop)
+      throw std::runtime_error{"Batcher is stopped"};
+    _queue.emplace_back(std::move(request));
+  }
+  _cv.notify_one();
+  return future;
+}
+
+BatcherStats Batcher::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+Batcher::Bucket &Batcher::findBucket(uint32_t batch)
+{
+  // Buckets are sorted and the last one is max_batch
+  auto it = std::find_if(_buckets.begin(), _buckets.end(),
+                         [&](const std::unique_ptr<Bucket> &b) { return b->batch >= batch; });
+  return **it;
+}
+
+void Batcher::work()
+{
+  while (true)
+  {
+    std::vector<Request> batch;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [&]() { return _stop || !_queue.empty(); });
+      // Requests left at stop are still run
+      if (_queue.empty())
+        return;
+
+      const auto deadline = _queue.front().arrival + _options.timeout;
+      _cv.wait_until(lock, deadline,
+                     [&]() { return _stop || _queue.size() >= _options.max_batch; });
+
+      const auto n = std::min<size_t>(_queue.size(), _options.max_batch);
+      for (size_t i = 0; i < n; ++i)
+      {
+        batch.emplace_back(std::move(_queue.front()));
+        _queue.pop_front();
+      }
+    }
+    runBatch(batch);
+  }
+}
+
+void Batcher::runBatch(std::vector<Request> &batch)
+{
+  const auto n = static_cast<uint32_t>(batch.size());
+  auto &bucket = findBucket(n);
+  try
+  {
+    // Rows after n are left as they are, and their outputs are dropped
+    for (uint32_t k = 0; k < n; ++k)
+      for (size_t i = 0; i < _input_bytes.size(); ++i)
+        std::memcpy(bucket.inputs[i].data() + k * _input_bytes[i], batch[k].inputs[i],
+                    _input_bytes[i]);
+
+    check(nnfw_run(bucket.session), "nnfw_run");
+
+    for (uint32_t k = 0; k < n; ++k)
+    {
+      for (size_t i = 0; i < _output_bytes.size(); ++i)
+        std::memcpy(batch[k].outputs[i], bucket.outputs[i].data() + k * _output_bytes[i],
+                    _output_bytes[i]);
+      batch[k].done.set_value();
+    }
+  }
+  catch (...)
+  {
+    for (auto &request : batch)
+      request.done.set_exception(std::current_exception());
+  }
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _stats.batches++;
+  _stats.requests += n;
+  _stats.padded += bucket.batch - n;
+}
+
+} // namespace batching
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BATCHING_BATCHER_H__
+#define __BATCHING_BATCHER_H__
+
+#include "nnfw.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace batching
+{
+
+/**
+ * @brief Options of Batcher
+ */
+struct BatcherOptions
+{
+  // Maximum number of requests run as a batch
+  uint32_t max_batch = 8;
+  // Time to wait for more requests since the first request of a batch arrives
+  std::chrono::microseconds timeout{1000};
+  // Batch sizes to compile the model for, powers of two up to max_batch if empty
+  std::vector<uint32_t> buckets;
+  // Backends such as "cpu", empty for default
+  std::string backends;
+};
+
+/**
+ * @brief Statistics of Batcher
+ */
+struct BatcherStats
+{
+  uint64_t batches = 0;
+  uint64_t requests = 0;
+  // Rows run for nothing to fill buckets
+  uint64_t padded = 0;
+};
+
+/**
+ * @brief Batching layer to run single-sample requests as batches
+ *
+ * A session is prepared for each batch size of buckets with static shapes, so that each of them
+ * has its own memory planned at compilation and runs without shape inference or reallocation.
+ * A worker thread collects requests until there are max_batch requests or timeout passes since
+ * the first one, copies inputs into the smallest bucket which fits, runs it and copies outputs
+ * back to each request.
+ *
+ * @note Each bucket loads the model into its own session, so memory grows with the number of
+ *       buckets. See README.md.
+ *
+ * The model must take and return tensors whose first dimension is batch, with batch size 1.
+ */
+class Batcher
+{
+public:
+  /**
+   * @param model_path Path to nnpackage directory or model file
+   * @param options    Options
+   */
+  Batcher(const std::string &model_path, const BatcherOptions &options);
+  ~Batcher();
+
+  Batcher(const Batcher &) = delete;
+  Batcher &operator=(const Batcher &) = delete;
+
+public:
+  uint32_t inputSize() const { return static_cast<uint32_t>(_input_bytes.size()); }
+  uint32_t outputSize() const { return static_cast<uint32_t>(_output_bytes.size()); }
+  // Size in bytes of a sample of an input
+  size_t inputBytes(uint32_t index) const { return _input_bytes.at(index); }
+  // Size in bytes of a sample of an output
+  size_t outputBytes(uint32_t index) const { return _output_bytes.at(index); }
+
+  /**
+   * @brief Submit a request
+   *
+   * Buffers must stay valid until the returned future is ready.
+   *
+   * @param inputs  Buffers of inputs, each of inputBytes()
+   * @param outputs Buffers of outputs, each of outputBytes()
+   * @return Future which is ready when outputs are written, or has an exception if failed
+   */
+  std::future<void> submit(std::vector<const void *> inputs, std::vector<void *> outputs);
+
+  BatcherStats stats() const;
+
+private:
+  struct Request
+  {
+    std::vector<const void *> inputs;
+    std::vector<void *> outputs;
+    std::chrono::steady_clock::time_point arrival;
+    std::promise<void> done;
+  };
+
+  /**
+   * @brief A session prepared for a batch size with its own I/O buffers
+   */
+  struct Bucket
+  {
+    uint32_t batch;
+    nnfw_session *session = nullptr;
+    std::vector<std::vector<uint8_t>> inputs;
+    std::vector<std::vector<uint8_t>> outputs;
+  };
+
+private:
+  void prepareBucket(Bucket &bucket, const std::string &model_path);
+  Bucket &findBucket(uint32_t batch);
+  void work();
+  void runBatch(std::vector<Request> &batch);
+
+private:
+  BatcherOptions _options;
+  std::vector<std::unique_ptr<Bucket>> _buckets;
+  std::vector<size_t> _input_bytes;
+  std::vector<size_t> _output_bytes;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<Request> _queue;
+  bool _stop = false;
+  BatcherStats _stats;
+  std::thread _worker;
+};
+
+} // namespace batching
+
+#endif // __BATCHING_BATCHER_H__
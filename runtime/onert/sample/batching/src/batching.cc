@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Batcher.h"
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+
+struct Args
+{
+  std::string model_path;
+  uint64_t requests = 1000;
+  uint32_t clients = 0; // max_batch if 0
+  batching::BatcherOptions options;
+};
+
+void printUsage(const char *prog)
+{
+  std::cerr << "Usage: " << prog << " path_to_model [options]" << std::endl
+            << "  --requests N     Number of requests to run (default: 1000)" << std::endl
+            << "  --clients N      Number of threads sending requests (default: max batch)"
+            << std::endl
+            << "  --max-batch N    Maximum batch size (default: 8)" << std::endl
+            << "  --timeout-us N   Time to wait for a batch to fill (default: 1000)" << std::endl
+            << "  --backends B     Backends, e.g. 'cpu'" << std::endl;
+}
+
+Args parseArgs(int argc, char **argv)
+{
+  Args args;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg.rfind("--", 0) != 0)
+    {
+      args.model_path = arg;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::invalid_argument{"No value for " + arg};
+    const std::string value = argv[++i];
+    if (arg == "--requests")
+      args.requests = std::stoull(value);
+    else if (arg == "--clients")
+      args.clients = static_cast<uint32_t>(std::stoul(value));
+    else if (arg == "--max-batch")
+      args.options.max_batch = static_cast<uint32_t>(std::stoul(value));
+    else if (arg == "--timeout-us")
+      args.options.timeout = std::chrono::microseconds{std::stoll(value)};
+    else if (arg == "--backends")
+      args.options.backends = value;
+    else
+      throw std::invalid_argument{"Unknown option " + arg};
+  }
+  if (args.model_path.empty())
+    throw std::invalid_argument{"No model"};
+  if (args.clients == 0)
+    args.clients = args.options.max_batch;
+  return args;
+}
+
+// Send requests from clients in closed loop, and print throughput and latency
+void benchmark(const std::string &title, batching::Batcher &batcher, uint64_t requests,
+               uint32_t clients)
+{
+  std::atomic<uint64_t> issued{0};
+  std::atomic<uint64_t> total_latency_ns{0};
+  std::vector<std::exception_ptr> errors(clients);
+
+  const auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (uint32_t c = 0; c < clients; ++c)
+  {
+    threads.emplace_back([&, c]() {
+      // Inputs are left as zeros. Please fill them in your way.
+      std::vector<std::vector<uint8_t>> inputs(batcher.inputSize());
+      std::vector<std::vector<uint8_t>> outputs(batcher.outputSize());
+      std::vector<const void *> input_ptrs;
+      std::vector<void *> output_ptrs;
+      for (uint32_t i = 0; i < batcher.inputSize(); ++i)
+      {
+        inputs[i].resize(batcher.inputBytes(i));
+        input_ptrs.emplace_back(inputs[i].data());
+      }
+      for (uint32_t i = 0; i < batcher.outputSize(); ++i)
+      {
+        outputs[i].resize(batcher.outputBytes(i));
+        output_ptrs.emplace_back(outputs[i].data());
+      }
+
+      try
+      {
+        while (issued.fetch_add(1) < requests)
+        {
+          const auto submitted = std::chrono::steady_clock::now();
+          batcher.submit(input_ptrs, output_ptrs).get();
+          total_latency_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - submitted)
+                                .count();
+        }
+      }
+      catch (...)
+      {
+        errors[c] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  const auto seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  for (const auto &error : errors)
+    if (error)
+      std::rethrow_exception(error);
+
+  const auto stats = batcher.stats();
+  std::cout << title << ": " << std::fixed << std::setprecision(2) << requests / seconds
+            << " requests/s" << std::endl
+            << "  mean latency: " << total_latency_ns / 1e6 / requests << " ms" << std::endl
+            << "  mean batch size: " << static_cast<double>(stats.requests) / stats.batches
+            << std::endl
+            << "  padded rows: " << stats.padded << std::endl;
+}
+
+} // namespace
+
+int main(const int argc, char **argv)
+{
+  try
+  {
+    const auto args = parseArgs(argc, argv);
+
+    {
+      // Baseline which runs each request alone
+      auto options = args.options;
+      options.max_batch = 1;
+      options.buckets.clear();
+      batching::Batcher batcher{args.model_path, options};
+      benchmark("unbatched", batcher, args.requests, args.clients);
+    }
+    {
+      batching::Batcher batcher{args.model_path, args.options};
+      benchmark("batched", batcher, args.requests, args.clients);
+    }
+  }
+  catch (const std::invalid_argument &e)
+  {
+    std::cerr << e.what() << std::endl;
+    printUsage(argv[0]);
+    return 1;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Pipeline.h"
+#include "SpscQueue.h"
+
+#include "nnfw_experimental.h"
+#include "nnfw_internal.h"
+
+#include <json/json.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using namespace pipeline;
+
+void check(NNFW_STATUS status, const std::string &what)
+{
+  if (status != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error{what + " failed with status " + std::to_string(status)};
+}
+
+std::vector<std::string> toStrings(const Json::Value &value)
+{
+  std::vector<std::string> strs;
+  for (const auto &v : value)
+    strs.emplace_back(v.asString());
+  return strs;
+}
+
+Part toPart(const Json::Value &value, const std::string &base_dir)
+{
+  Part part;
+  part.model_file = base_dir + value["file"].asString();
+  part.inputs = toStrings(value["inputs"]);
+  part.outputs = toStrings(value["outputs"]);
+  return part;
+}
+
+// Sort parts so that all inputs of a part are the source inputs or outputs of former parts
+std::vector<Part> sortParts(const Part &source, std::vector<Part> parts)
+{
+  std::set<std::string> available(source.inputs.begin(), source.inputs.end());
+  std::vector<Part> sorted;
+  while (!parts.empty())
+  {
+    auto it = std::find_if(parts.begin(), parts.end(), [&](const Part &part) {
+      return std::all_of(part.inputs.begin(), part.inputs.end(),
+                         [&](const std::string &name) { return available.count(name) > 0; });
+    });
+    if (it == parts.end())
+      throw std::runtime_error{"Parts are not connected or have a cycle"};
+
+    available.insert(it->outputs.begin(), it->outputs.end());
+    sorted.emplace_back(std::move(*it));
+    parts.erase(it);
+  }
+  return sorted;
+}
+
+uint64_t nowNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point begin)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+} // namespace
+
+namespace pipeline
+{
+
+PartConfig loadPartConfig(const std::string &json_path)
+{
+  std::ifstream ifs(json_path);
+  if (!ifs)
+    throw std::runtime_error{"Cannot open " + json_path};
+
+  Json::Value root;
+  ifs >> root;
+
+  const auto slash = json_path.find_last_of('/');
+  const auto base_dir = slash == std::string::npos ? "" : json_path.substr(0, slash + 1);
+
+  PartConfig config;
+  config.source = toPart(root["source"], base_dir);
+  std::vector<Part> parts;
+  for (const auto &part : root["parts"])
+    parts.emplace_back(toPart(part, base_dir));
+  if (parts.empty())
+    throw std::runtime_error{json_path + " has no parts"};
+  config.parts = sortParts(config.source, std::move(parts));
+  return config;
+}
+
+std::vector<uint32_t> parseCpuList(const std::string &str)
+{
+  std::vector<uint32_t> cpus;
+  size_t pos = 0;
+  while (pos < str.size())
+  {
+    auto end = str.find(',', pos);
+    if (end == std::string::npos)
+      end = str.size();
+    const auto item = str.substr(pos, end - pos);
+    const auto dash = item.find('-');
+    const auto first = std::stoul(item.substr(0, dash));
+    const auto last = dash == std::string::npos ? first : std::stoul(item.substr(dash + 1));
+    if (last < first)
+      throw std::invalid_argument{"Invalid CPU range " + item};
+    for (auto cpu = first; cpu <= last; ++cpu)
+      cpus.emplace_back(static_cast<uint32_t>(cpu));
+    pos = end + 1;
+  }
+  return cpus;
+}
+
+void setThreadAffinity(const std::vector<uint32_t> &cpus)
+{
+  if (cpus.empty())
+    return;
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : cpus)
+    CPU_SET(cpu, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+    throw std::runtime_error{"Cannot set thread affinity"};
+}
+
+uint64_t bufsizeFor(const nnfw_tensorinfo &ti)
+{
+  static const uint64_t elmsize[] = {
+    sizeof(float),   /* NNFW_TYPE_TENSOR_FLOAT32 */
+    sizeof(int),     /* NNFW_TYPE_TENSOR_INT32 */
+    sizeof(uint8_t), /* NNFW_TYPE_TENSOR_QUANT8_ASYMM */
+    sizeof(bool),    /* NNFW_TYPE_TENSOR_BOOL = 3 */
+    sizeof(uint8_t), /* NNFW_TYPE_TENSOR_UINT8 = 4 */
+    sizeof(int64_t), /* NNFW_TYPE_TENSOR_INT64 = 5 */
+    sizeof(int8_t),  /* NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 6 */
+    sizeof(int16_t), /* NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED = 7 */
+  };
+  uint64_t n = 1;
+  for (int32_t i = 0; i < ti.rank; ++i)
+    n *= ti.dims[i];
+  return elmsize[ti.dtype] * n;
+}
+
+Stage::Stage(const Part &part, const StageOptions &options)
+  : _part{part}, _cpus{parseCpuList(options.cpus)}
+{
+  check(nnfw_create_session(&_session), "nnfw_create_session");
+  try
+  {
+    check(nnfw_load_model_from_modelfile(_session, _part.model_file.c_str()),
+          "Loading " + _part.model_file);
+    if (!options.backends.empty())
+      check(nnfw_set_available_backends(_session, options.backends.c_str()),
+            "nnfw_set_available_backends");
+    if (!_cpus.empty())
+    {
+      // Keep kernel threads of the stage on its own cores
+      check(nnfw_set_config(_session, "CPU_AFFINITY", options.cpus.c_str()), "CPU_AFFINITY");
+      check(nnfw_set_config(_session, "CPU_THREADS", std::to_string(_cpus.size()).c_str()),
+            "CPU_THREADS");
+    }
+    check(nnfw_prepare(_session), "Preparing " + _part.model_file);
+  }
+  catch (...)
+  {
+    nnfw_close_session(_session);
+    throw;
+  }
+}
+
+Stage::~Stage() { nnfw_close_session(_session); }
+
+nnfw_tensorinfo Stage::inputInfo(const std::string &name) const
+{
+  uint32_t index = 0;
+  check(nnfw_input_tensorindex(_session, name.c_str(), &index), "Finding input " + name);
+  nnfw_tensorinfo ti;
+  check(nnfw_input_tensorinfo(_session, index, &ti), "nnfw_input_tensorinfo");
+  return ti;
+}
+
+nnfw_tensorinfo Stage::outputInfo(const std::string &name) const
+{
+  uint32_t index = 0;
+  check(nnfw_output_tensorindex(_session, name.c_str(), &index), "Finding output " + name);
+  nnfw_tensorinfo ti;
+  check(nnfw_output_tensorinfo(_session, index, &ti), "nnfw_output_tensorinfo");
+  return ti;
+}
+
+void Stage::bind(const std::unordered_map<std::string, uint32_t> &tensor_indices)
+{
+  _inputs.clear();
+  _outputs.clear();
+  for (const auto &name : _part.inputs)
+  {
+    uint32_t index = 0;
+    check(nnfw_input_tensorindex(_session, name.c_str(), &index), "Finding input " + name);
+    _inputs.push_back({index, tensor_indices.at(name), inputInfo(name).dtype});
+  }
+  for (const auto &name : _part.outputs)
+  {
+    uint32_t index = 0;
+    check(nnfw_output_tensorindex(_session, name.c_str(), &index), "Finding output " + name);
+    _outputs.push_back({index, tensor_indices.at(name), outputInfo(name).dtype});
+  }
+}
+
+void Stage::run(Frame &frame)
+{
+  // Frames are handed over between threads, so point the session to the tensors of this frame
+  // instead of copying them
+  for (const auto &in : _inputs)
+  {
+    auto &buf = frame.tensors[in.tensor_index];
+    check(nnfw_set_input(_session, in.io_index, in.type, buf.data(), buf.size()),
+          "nnfw_set_input");
+  }
+  for (const auto &out : _outputs)
+  {
+    auto &buf = frame.tensors[out.tensor_index];
+    check(nnfw_set_output(_session, out.io_index, out.type, buf.data(), buf.size()),
+          "nnfw_set_output");
+  }
+
+  const auto begin = nowNs();
+  check(nnfw_run(_session), "Running " + _part.model_file);
+  _total_ns += nowNs() - begin;
+  ++_runs;
+}
+
+void Stage::resetStats()
+{
+  _runs = 0;
+  _total_ns = 0;
+}
+
+Pipeline::Pipeline(const PartConfig &config, const std::vector<StageOptions> &options,
+                   uint32_t depth)
+{
+  if (depth == 0)
+    throw std::invalid_argument{"Depth must be positive"};
+
+  for (size_t i = 0; i < config.parts.size(); ++i)
+  {
+    const auto stage_options = i < options.size() ? options[i] : StageOptions{};
+    _stages.emplace_back(std::make_unique<Stage>(config.parts[i], stage_options));
+  }
+
+  // A tensor is written by the producer or one stage, so it gets one buffer per frame
+  auto add_tensor = [&](const std::string &name, const nnfw_tensorinfo &ti) {
+    if (_tensor_indices.count(name) > 0)
+      throw std::runtime_error{"Tensor " + name + " is written twice"};
+    _tensor_indices[name] = static_cast<uint32_t>(_tensor_infos.size());
+    _tensor_infos.emplace_back(ti);
+  };
+  for (const auto &name : config.source.inputs)
+  {
+    // Find a stage taking the source input to get its info
+    auto it = std::find_if(_stages.begin(), _stages.end(), [&](const std::unique_ptr<Stage> &s) {
+      const auto &inputs = s->part().inputs;
+      return std::find(inputs.begin(), inputs.end(), name) != inputs.end();
+    });
+    if (it == _stages.end())
+      throw std::runtime_error{"No part takes source input " + name};
+    add_tensor(name, (*it)->inputInfo(name));
+  }
+  for (const auto &stage : _stages)
+    for (const auto &name : stage->part().outputs)
+      add_tensor(name, stage->outputInfo(name));
+
+  for (const auto &stage : _stages)
+    stage->bind(_tensor_indices);
+
+  _frames.resize(depth);
+  for (auto &frame : _frames)
+    for (const auto &ti : _tensor_infos)
+      frame.tensors.emplace_back(bufsizeFor(ti));
+}
+
+Pipeline::~Pipeline() = default;
+
+double Pipeline::runSequential(uint64_t frames, const Producer &producer,
+                               const Consumer &consumer)
+{
+  for (auto &stage : _stages)
+    stage->resetStats();
+
+  auto &frame = _frames.front();
+  const auto begin = std::chrono::steady_clock::now();
+  for (uint64_t id = 0; id < frames; ++id)
+  {
+    frame.id = id;
+    producer(frame);
+    for (auto &stage : _stages)
+      stage->run(frame);
+    consumer(frame);
+  }
+  return secondsSince(begin);
+}
+
+double Pipeline::runPipelined(uint64_t frames, const Producer &producer,
+                              const Consumer &consumer)
+{
+  for (auto &stage : _stages)
+    stage->resetStats();
+
+  const auto depth = _frames.size();
+  // queues[i] feeds stage i, and queues.back() feeds the consumer. nullptr stops threads.
+  std::vector<std::unique_ptr<SpscQueue<Frame *>>> queues;
+  for (size_t i = 0; i <= _stages.size(); ++i)
+    queues.emplace_back(std::make_unique<SpscQueue<Frame *>>(depth));
+  // Frames go back from the consumer to the producer
+  SpscQueue<Frame *> free_frames(depth);
+  for (auto &frame : _frames)
+    free_frames.push(&frame);
+
+  // An exception in a thread is kept and thrown after all threads are joined
+  std::vector<std::exception_ptr> errors(_stages.size() + 1);
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < _stages.size(); ++i)
+  {
+    threads.emplace_back([&, i]() {
+      auto &stage = *_stages[i];
+      auto &in = *queues[i];
+      auto &out = *queues[i + 1];
+      bool failed = false;
+      try
+      {
+        setThreadAffinity(stage.cpus());
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+        failed = true;
+      }
+      for (auto frame = in.pop(); frame != nullptr; frame = in.pop())
+      {
+        if (!failed)
+        {
+          try
+          {
+            stage.run(*frame);
+          }
+          catch (...)
+          {
+            errors[i] = std::current_exception();
+            failed = true;
+          }
+        }
+        // Pass frames anyway so that the others do not wait forever
+        out.push(frame);
+      }
+      out.push(nullptr);
+    });
+  }
+  threads.emplace_back([&]() {
+    auto &in = *queues.back();
+    bool failed = false;
+    for (auto frame = in.pop(); frame != nullptr; frame = in.pop())
+    {
+      if (!failed)
+      {
+        try
+        {
+          consumer(*frame);
+        }
+        catch (...)
+        {
+          errors.back() = std::current_exception();
+          failed = true;
+        }
+      }
+      free_frames.push(frame);
+    }
+  });
+
+  const auto begin = std::chrono::steady_clock::now();
+  std::exception_ptr producer_error;
+  for (uint64_t id = 0; id < frames && !producer_error; ++id)
+  {
+    auto frame = free_frames.pop();
+    frame->id = id;
+    try
+    {
+      producer(*frame);
+      queues.front()->push(frame);
+    }
+    catch (...)
+    {
+      producer_error = std::current_exception();
+    }
+  }
+  queues.front()->push(nullptr);
+  for (auto &thread : threads)
+    thread.join();
+  const auto elapsed = secondsSince(begin);
+
+  if (producer_error)
+    std::rethrow_exception(producer_error);
+  for (const auto &error : errors)
+    if (error)
+      std::rethrow_exception(error);
+  return elapsed;
+}
+
+} // namespace pipeline
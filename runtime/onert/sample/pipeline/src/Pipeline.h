@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_PIPELINE_H__
+#define __PIPELINE_PIPELINE_H__
+
+#include "nnfw.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pipeline
+{
+
+/**
+ * @brief Model file and I/O tensor names of a partitioned model
+ */
+struct Part
+{
+  std::string model_file;
+  std::vector<std::string> inputs;
+  std::vector<std::string> outputs;
+};
+
+/**
+ * @brief Connection of partitioned models, which circle-partitioner writes as json
+ */
+struct PartConfig
+{
+  Part source;
+  std::vector<Part> parts;
+};
+
+/**
+ * @brief Load connection json of circle-partitioner
+ *
+ * Model files are relative to the json file, and parts are sorted so that a part comes after the
+ * parts it takes inputs from.
+ */
+PartConfig loadPartConfig(const std::string &json_path);
+
+/**
+ * @brief Tensors of one input going through the pipeline
+ */
+struct Frame
+{
+  uint64_t id = 0;
+  // Buffers of the source inputs and outputs of all parts, indexed by Pipeline::tensorIndex()
+  std::vector<std::vector<uint8_t>> tensors;
+};
+
+/**
+ * @brief Options of a stage
+ */
+struct StageOptions
+{
+  std::string cpus;     // CPU list such as "0-1", empty for any CPU
+  std::string backends; // Backends such as "cpu", empty for default
+};
+
+class Stage;
+
+/**
+ * @brief Pipeline of partitioned models, where each part is a stage
+ *
+ * In pipelined mode each stage runs on its own thread, and frames go through bounded lock-free
+ * queues between stages, so that frame k+1 runs on a stage while frame k runs on the next stage.
+ * Then throughput approaches 1 / (latency of the slowest stage).
+ */
+class Pipeline
+{
+public:
+  using Producer = std::function<void(Frame &)>;
+  using Consumer = std::function<void(const Frame &)>;
+
+public:
+  /**
+   * @param config Partitioned models
+   * @param options Options of each stage, which may have less elements than parts
+   * @param depth Number of frames in flight
+   */
+  Pipeline(const PartConfig &config, const std::vector<StageOptions> &options, uint32_t depth);
+  ~Pipeline();
+
+public:
+  uint32_t numStages() const { return static_cast<uint32_t>(_stages.size()); }
+  const Stage &stage(uint32_t index) const { return *_stages.at(index); }
+
+  /**
+   * @brief Index of a tensor in Frame::tensors
+   */
+  uint32_t tensorIndex(const std::string &name) const { return _tensor_indices.at(name); }
+  const nnfw_tensorinfo &tensorInfo(const std::string &name) const
+  {
+    return _tensor_infos.at(tensorIndex(name));
+  }
+
+  /**
+   * @brief Run frames through all stages one after another on the calling thread
+   *
+   * @param frames   Number of frames to run
+   * @param producer Function to fill source inputs of a frame
+   * @param consumer Function to take outputs of a frame
+   * @return Elapsed time in seconds
+   */
+  double runSequential(uint64_t frames, const Producer &producer, const Consumer &consumer);
+
+  /**
+   * @brief Run frames through stages running on their own threads
+   *
+   * Producer runs on the calling thread, and consumer runs on another thread. Both take frames in
+   * order.
+   *
+   * @return Elapsed time in seconds
+   */
+  double runPipelined(uint64_t frames, const Producer &producer, const Consumer &consumer);
+
+private:
+  std::vector<std::unique_ptr<Stage>> _stages;
+  std::unordered_map<std::string, uint32_t> _tensor_indices;
+  std::vector<nnfw_tensorinfo> _tensor_infos;
+  std::vector<Frame> _frames;
+};
+
+/**
+ * @brief A partitioned model with its own session
+ */
+class Stage
+{
+public:
+  Stage(const Part &part, const StageOptions &options);
+  ~Stage();
+
+  Stage(const Stage &) = delete;
+  Stage &operator=(const Stage &) = delete;
+
+public:
+  const Part &part() const { return _part; }
+  const std::vector<uint32_t> &cpus() const { return _cpus; }
+  nnfw_tensorinfo inputInfo(const std::string &name) const;
+  nnfw_tensorinfo outputInfo(const std::string &name) const;
+
+  /**
+   * @brief Bind inputs and outputs to tensors of frames
+   */
+  void bind(const std::unordered_map<std::string, uint32_t> &tensor_indices);
+
+  /**
+   * @brief Run the model on tensors of a frame
+   */
+  void run(Frame &frame);
+
+  uint64_t runs() const { return _runs; }
+  // Sum of latencies in nanoseconds
+  uint64_t totalLatency() const { return _total_ns; }
+  void resetStats();
+
+private:
+  struct Binding
+  {
+    uint32_t io_index;
+    uint32_t tensor_index;
+    NNFW_TYPE type;
+  };
+
+private:
+  Part _part;
+  std::vector<uint32_t> _cpus;
+  nnfw_session *_session = nullptr;
+  std::vector<Binding> _inputs;
+  std::vector<Binding> _outputs;
+  uint64_t _runs = 0;
+  uint64_t _total_ns = 0;
+};
+
+/**
+ * @brief Parse a CPU list such as "0-3,6"
+ */
+std::vector<uint32_t> parseCpuList(const std::string &str);
+
+/**
+ * @brief Bind the calling thread to the CPUs, nothing is done if empty
+ */
+void setThreadAffinity(const std::vector<uint32_t> &cpus);
+
+uint64_t bufsizeFor(const nnfw_tensorinfo &ti);
+
+} // namespace pipeline
+
+#endif // __PIPELINE_PIPELINE_H__
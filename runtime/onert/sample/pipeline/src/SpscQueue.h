@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_SPSC_QUEUE_H__
+#define __PIPELINE_SPSC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace pipeline
+{
+
+/**
+ * @brief Bounded lock-free queue for one producer thread and one consumer thread
+ */
+template <typename T> class SpscQueue
+{
+public:
+  explicit SpscQueue(size_t capacity) : _slots(capacity + 1) {}
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+public:
+  bool tryPush(const T &value)
+  {
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    const auto next = advance(tail);
+    if (next == _head.load(std::memory_order_acquire))
+      return false; // Full
+    _slots[tail] = value;
+    _tail.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool tryPop(T &value)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire))
+      return false; // Empty
+    value = _slots[head];
+    _head.store(advance(head), std::memory_order_release);
+    return true;
+  }
+
+  // Wait until there is room
+  void push(const T &value)
+  {
+    for (uint32_t spins = 0; !tryPush(value); ++spins)
+      backoff(spins);
+  }
+
+  // Wait until there is a value
+  T pop()
+  {
+    T value;
+    for (uint32_t spins = 0; !tryPop(value); ++spins)
+      backoff(spins);
+    return value;
+  }
+
+private:
+  size_t advance(size_t index) const { return index + 1 == _slots.size() ? 0 : index + 1; }
+
+  static void backoff(uint32_t spins)
+  {
+    // Stages usually take milliseconds, so give the core away soon
+    if (spins >= SPINS_BEFORE_YIELD)
+      std::this_thread::yield();
+  }
+
+private:
+  static constexpr uint32_t SPINS_BEFORE_YIELD = 64;
+
+  // The producer and the consumer write on different cache lines
+  alignas(64) std::atomic<size_t> _head{0};
+  alignas(64) std::atomic<size_t> _tail{0};
+  // One slot is left empty to tell full from empty
+  std::vector<T> _slots;
+};
+
+} // namespace pipeline
+
+#endif // __PIPELINE_SPSC_QUEUE_H__
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Pipeline.h"
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+
+struct Args
+{
+  std::string conn_json;
+  uint64_t frames = 100;
+  uint32_t depth = 0; // Number of stages + 1 if 0
+  std::vector<pipeline::StageOptions> stages;
+};
+
+std::vector<std::string> split(const std::string &str, char delim)
+{
+  std::vector<std::string> items;
+  size_t pos = 0;
+  while (true)
+  {
+    const auto end = str.find(delim, pos);
+    items.emplace_back(str.substr(pos, end - pos));
+    if (end == std::string::npos)
+      break;
+    pos = end + 1;
+  }
+  return items;
+}
+
+void printUsage(const char *prog)
+{
+  std::cerr << "Usage: " << prog << " path_to_conn_json [options]" << std::endl
+            << "  --frames N          Number of frames to run (default: 100)" << std::endl
+            << "  --depth N           Number of frames in flight (default: stages + 1)" << std::endl
+            << "  --cores 'L0;L1;..'  CPU list of each stage, e.g. '4-7;0-3'" << std::endl
+            << "  --backends 'B0;..'  Backends of each stage, e.g. 'cpu;ruy'" << std::endl;
+}
+
+Args parseArgs(int argc, char **argv)
+{
+  Args args;
+  std::vector<std::string> cores;
+  std::vector<std::string> backends;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg.rfind("--", 0) != 0)
+    {
+      args.conn_json = arg;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::invalid_argument{"No value for " + arg};
+    const std::string value = argv[++i];
+    if (arg == "--frames")
+      args.frames = std::stoull(value);
+    else if (arg == "--depth")
+      args.depth = static_cast<uint32_t>(std::stoul(value));
+    else if (arg == "--cores")
+      cores = split(value, ';');
+    else if (arg == "--backends")
+      backends = split(value, ';');
+    else
+      throw std::invalid_argument{"Unknown option " + arg};
+  }
+  if (args.conn_json.empty())
+    throw std::invalid_argument{"No connection json"};
+
+  args.stages.resize(std::max(cores.size(), backends.size()));
+  for (size_t i = 0; i < cores.size(); ++i)
+    args.stages[i].cpus = cores[i];
+  for (size_t i = 0; i < backends.size(); ++i)
+    args.stages[i].backends = backends[i];
+  return args;
+}
+
+void printStats(const std::string &title, const pipeline::Pipeline &pipeline, uint64_t frames,
+                double seconds)
+{
+  std::cout << title << ": " << std::fixed << std::setprecision(2) << frames / seconds << " fps"
+            << std::endl;
+  double slowest_ms = 0;
+  for (uint32_t i = 0; i < pipeline.numStages(); ++i)
+  {
+    const auto &stage = pipeline.stage(i);
+    const double mean_ms = stage.runs() == 0 ? 0 : stage.totalLatency() / 1e6 / stage.runs();
+    slowest_ms = std::max(slowest_ms, mean_ms);
+    std::cout << "  stage " << i << " (" << stage.part().model_file << "): " << mean_ms
+              << " ms/frame" << std::endl;
+  }
+  if (slowest_ms > 0)
+    std::cout << "  bound by the slowest stage: " << 1e3 / slowest_ms << " fps" << std::endl;
+}
+
+} // namespace
+
+int main(const int argc, char **argv)
+{
+  try
+  {
+    const auto args = parseArgs(argc, argv);
+    const auto config = pipeline::loadPartConfig(args.conn_json);
+    const auto depth = args.depth > 0 ? args.depth : static_cast<uint32_t>(config.parts.size() + 1);
+    pipeline::Pipeline pipeline{config, args.stages, depth};
+
+    // Inputs are left as they are. Please fill them in your way.
+    auto producer = [](pipeline::Frame &) {};
+    // Outputs are dropped. Please take them in your way.
+    auto consumer = [](const pipeline::Frame &) {};
+
+    // Warm up
+    pipeline.runSequential(1, producer, consumer);
+
+    const auto sequential = pipeline.runSequential(args.frames, producer, consumer);
+    printStats("sequential", pipeline, args.frames, sequential);
+    const auto pipelined = pipeline.runPipelined(args.frames, producer, consumer);
+    printStats("pipelined", pipeline, args.frames, pipelined);
+  }
+  catch (const std::invalid_argument &e)
+  {
+    std::cerr << e.what() << std::endl;
+    printUsage(argv[0]);
+    return 1;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -490,6 +490,55 @@ TEST_P(HESchedulerTestWithExecutorParam, branched_graph_known_exec_time)
   }
 }
 
+// Test scheduler behavior with exec times shared with executors, and makespan estimation
+TEST_P(HESchedulerTestWithExecutorParam, straight_graph_shared_exec_time)
+{
+  setExecutor(GetParam());
+
+  // Prepare graph
+  ir::Subgraphs subgs;
+  auto graph(createStraightGraph());
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  OperationIndex add_op_idx(0), sub_op_idx(1), mul_op_idx(2);
+
+  // Set default execution and transfer time
+  setPermutationsExecutionTime(_mock_backends, OPERAND_SIZE, 1);
+  setOperationsExecutionTime(_mock_backends, {"Add", "Sub", "Mul"},
+                             {OPERATION_SIZE, OPERATION_SIZE, OPERATION_SIZE}, 1e4);
+
+  auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+  options.he_exec_time = std::make_shared<ExecTime>(_mock_backends);
+
+  // Expected behaviour: scheduler uses exec times updated without being stored
+  for (const auto &op : {"Add", "Sub", "Mul"})
+    setOperationExecTime(*options.he_exec_time, _gpu_backend, op, false, OPERATION_SIZE, 1);
+
+  auto scheduler = compiler::HEScheduler(_mock_backends, options);
+  const auto br = scheduler.schedule(*graph);
+  ASSERT_EQ(br->getBackend(add_op_idx)->config()->id(), "gpu");
+  ASSERT_EQ(br->getBackend(sub_op_idx)->config()->id(), "gpu");
+  ASSERT_EQ(br->getBackend(mul_op_idx)->config()->id(), "gpu");
+
+  // Expected behaviour: moving an operation to a slower backend increases makespan
+  const auto makespan =
+    compiler::HEScheduler(_mock_backends, options).estimateMakespan(*graph, *br);
+  ASSERT_EQ(makespan, 3);
+
+  compiler::BackendResolver moved;
+  moved.setBackend(add_op_idx, _gpu_backend);
+  moved.setBackend(sub_op_idx, _cpu_backend);
+  moved.setBackend(mul_op_idx, _gpu_backend);
+  ASSERT_GT(compiler::HEScheduler(_mock_backends, options).estimateMakespan(*graph, moved),
+            makespan + 1e4);
+
+  // Expected behaviour: makespan is unknown if an exec time is unknown
+  remove("exec_time.json");
+  options.he_exec_time = std::make_shared<ExecTime>(_mock_backends);
+  options.he_exec_time->storeOperationsExecTime(); // To be removed at TearDown
+  ASSERT_EQ(compiler::HEScheduler(_mock_backends, options).estimateMakespan(*graph, *br),
+            ExecTime::NOT_FOUND);
+}
+
 // SchedulerTestWithExecutorParam tests are parameterized with executor name and runs three times -
 // one time for each executor
 INSTANTIATE_TEST_CASE_P(AllExecutors, HESchedulerTestWithExecutorParam,
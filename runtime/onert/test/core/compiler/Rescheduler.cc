@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/BackendManager.h>
+#include <compiler/Compiler.h>
+#include <compiler/HEScheduler.h>
+#include <compiler/Rescheduler.h>
+#include <exec/ExecTime.h>
+#include <exec/Execution.h>
+#include <exec/OpStats.h>
+#include <ir/Graph.h>
+#include <ir/operation/FullyConnected.h>
+#include <util/TracingCtx.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+
+using namespace onert;
+using namespace ir;
+
+// Model: output <= FullyConnected(input, weights, bias), which both cpu and ruy support
+std::shared_ptr<Subgraphs> createFullyConnectedModel()
+{
+  static float weights_data[8] = {1, 2, 3, 4, -1, -2, -3, -4};
+  static float bias_data[2] = {1, -1};
+
+  auto graph = std::make_shared<Graph>();
+  TypeInfo type{DataType::FLOAT32};
+  auto input = graph->addOperand(Shape{1, 4}, type);
+  auto weights = graph->addOperand(Shape{2, 4}, type);
+  auto bias = graph->addOperand(Shape{2}, type);
+  auto output = graph->addOperand(Shape{1, 2}, type);
+  graph->operands()
+    .at(weights)
+    .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(weights_data), 32));
+  graph->operands()
+    .at(bias)
+    .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(bias_data), 8));
+
+  operation::FullyConnected::Param param;
+  param.activation = Activation::NONE;
+  param.weights_format = FullyConnectedWeightsFormat::Default;
+  graph->addOperation(std::make_unique<operation::FullyConnected>(
+    OperandIndexSequence{input, weights, bias}, OperandIndexSequence{output}, param));
+  graph->addInput(input);
+  graph->addOutput(output);
+  graph->verify();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  return subgs;
+}
+
+TEST(Rescheduler, swap_in_rescheduled_executors)
+{
+  auto &backend_manager = compiler::BackendManager::get();
+  backend_manager.loadBackend("cpu");
+  backend_manager.loadBackend("ruy");
+  const backend::Backend *cpu = backend_manager.get("cpu");
+  const backend::Backend *ruy = backend_manager.get("ruy");
+  ASSERT_NE(cpu, nullptr);
+  ASSERT_NE(ruy, nullptr);
+
+  // Both backends are profiled to be equally slow
+  const uint32_t fc_size = (4 + 8 + 2 + 2) * sizeof(float);
+  const int64_t slow_time = 1000000;
+  const std::vector<const backend::Backend *> backends{cpu, ruy};
+  auto exec_time = std::make_shared<exec::ExecTime>(backends);
+  exec_time->updateOperationExecTime(cpu, "FullyConnected", false, fc_size, slow_time);
+  exec_time->updateOperationExecTime(ruy, "FullyConnected", false, fc_size, slow_time);
+
+  auto subgs = createFullyConnectedModel();
+  auto tracing_ctx = std::make_unique<util::TracingCtx>(subgs.get());
+  compiler::Compiler compiler{subgs, tracing_ctx.get()};
+  auto &options = compiler.options();
+  options.backend_list = {"cpu", "ruy"};
+  options.executor = "Linear";
+  options.he_scheduler = true;
+  options.he_adaptive = true;
+  options.he_adaptive_interval = 1;
+  options.he_adaptive_threshold = 10;
+  options.he_exec_time = exec_time;
+  options.he_sampled_exec_time = exec_time;
+  options.op_stats = std::make_shared<exec::OpStats>();
+  // New executors are traced as well, into the trace file written at exit
+  options.trace_filepath = ::testing::TempDir() + "rescheduler_trace";
+  const auto op_stats = options.op_stats;
+  auto executors = compiler.compile();
+
+  compiler::Rescheduler rescheduler{createFullyConnectedModel, options};
+
+  // The backend not in the current schedule gets faster by half
+  const auto model = createFullyConnectedModel();
+  const auto current = compiler::HEScheduler(backend_manager.getAll(), options)
+                         .schedule(*model->primary())
+                         ->getBackend(OperationIndex{0});
+  const auto other = current == cpu ? ruy : cpu;
+  const int64_t fast_time = slow_time / 2;
+  exec_time->updateOperationExecTime(other, "FullyConnected", false, fc_size, 0);
+  ASSERT_EQ(exec_time->getOperationExecTime(other, "FullyConnected", false, fc_size), fast_time);
+
+  exec::Execution execution{executors};
+  const float input_buffer[4] = {1, 0, -1, 2};
+  float output_buffer[2] = {};
+  execution.setInput(IOIndex{0}, input_buffer, sizeof(input_buffer));
+  execution.setOutput(IOIndex{0}, output_buffer, sizeof(output_buffer));
+
+  // The new schedule must win in consecutive re-schedulings
+  std::unique_ptr<util::TracingCtx> new_tracing_ctx;
+  std::shared_ptr<exec::ExecutorMap> new_executors;
+  for (int i = 0; i < 500 && !new_executors; ++i)
+  {
+    rescheduler.notifyRun();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    new_executors = rescheduler.takeExecutors(new_tracing_ctx);
+  }
+  ASSERT_NE(new_executors, nullptr);
+  ASSERT_NE(new_tracing_ctx, nullptr);
+  ASSERT_NE(new_executors, executors);
+
+  // Current executors keep running until new ones are swapped in
+  execution.execute();
+  const auto current_time =
+    exec_time->getOperationExecTime(current, "FullyConnected", false, fc_size);
+
+  // Swapped in executors keep the I/O settings and run the operation on the other backend
+  execution.setExecutors(new_executors);
+  execution.execute();
+  ASSERT_EQ(output_buffer[0], 7);
+  ASSERT_EQ(output_buffer[1], -7);
+  ASSERT_EQ(exec_time->getOperationExecTime(current, "FullyConnected", false, fc_size),
+            current_time);
+  ASSERT_LT(exec_time->getOperationExecTime(other, "FullyConnected", false, fc_size), fast_time);
+
+  // Op stats cover the runs of both executors
+  const auto op_entry = op_stats->entries().front();
+  EXPECT_EQ(op_entry->op_index, OperationIndex{0});
+  EXPECT_EQ(op_entry->latency.count(), 2u);
+  EXPECT_EQ(op_entry->backend.load(), other);
+}
+
+} // namespace
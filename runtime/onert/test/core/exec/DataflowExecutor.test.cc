@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "util/TracingCtx.h"
+
+#include <memory>
+
+namespace
+{
+
+using namespace onert::ir;
+
+// Model: a chain of elementwise add operations with a constant
+// result(0) <= input + one
+// result(n) <= result(n-1) + one
+std::shared_ptr<Graph> createAddChain(uint32_t num_ops)
+{
+  static float one_data[4] = {1, 1, 1, 1};
+
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+
+  auto one = graph->addOperand(shape, type);
+  graph->operands().at(one).data(
+    std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&one_data), 16));
+
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+
+  auto input = graph->addOperand(shape, type);
+  auto lhs = input;
+  for (uint32_t i = 0; i < num_ops; ++i)
+  {
+    auto result = graph->addOperand(shape, type);
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, one}, OperandIndexSequence{result}, param));
+    lhs = result;
+  }
+
+  graph->addInput(input);
+  graph->addOutput(lhs);
+  graph->verify();
+  return graph;
+}
+
+// Model: a diamond whose first result is used by two operations
+// lhs <= input + one, rhs <= input + one
+// result <= lhs + rhs
+std::shared_ptr<Graph> createAddDiamond()
+{
+  static float one_data[4] = {1, 1, 1, 1};
+
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+
+  auto one = graph->addOperand(shape, type);
+  graph->operands().at(one).data(
+    std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&one_data), 16));
+
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+
+  auto input = graph->addOperand(shape, type);
+  auto lhs = graph->addOperand(shape, type);
+  auto rhs = graph->addOperand(shape, type);
+  auto result = graph->addOperand(shape, type);
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{input, one}, OperandIndexSequence{lhs}, param));
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{input, one}, OperandIndexSequence{rhs}, param));
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{result}, param));
+
+  graph->addInput(input);
+  graph->addOutput(result);
+  graph->verify();
+  return graph;
+}
+
+void executeDataflow(std::shared_ptr<Graph> graph, const float (&input_buffer)[4],
+                     float (&output_buffer)[4])
+{
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  auto tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgs.get());
+  onert::compiler::Compiler compiler{subgs, tracing_ctx.get()};
+  compiler.options().executor = "Dataflow";
+  subgs.reset();
+
+  auto executors = compiler.compile();
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  execution.execute();
+}
+
+TEST(DataflowExecutor, chain)
+{
+  const uint32_t num_ops = 16;
+  const float input_buffer[4] = {1, 0, -1, -2};
+  float output_buffer[4] = {};
+
+  executeDataflow(createAddChain(num_ops), input_buffer, output_buffer);
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], input_buffer[i] + num_ops);
+  }
+}
+
+TEST(DataflowExecutor, multiple_uses)
+{
+  const float input_buffer[4] = {1, 0, -1, -2};
+  float output_buffer[4] = {};
+
+  executeDataflow(createAddDiamond(), input_buffer, output_buffer);
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], (input_buffer[i] + 1) * 2);
+  }
+}
+
+} // namespace
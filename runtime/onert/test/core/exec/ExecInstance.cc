@@ -15,10 +15,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <thread>
 
 #include "ir/Graph.h"
 #include "compiler/Compiler.h"
+#include "compiler/ExecutorCache.h"
 #include "exec/Execution.h"
 #include "ir/operation/BinaryArithmetic.h"
 #include "util/TracingCtx.h"
@@ -298,4 +300,127 @@ TEST(ExecInstance, async)
   }
 }
 
+// User buffers set for a run should not be used by the next runs
+TEST(ExecInstance, changeIOBuffers)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffers[2][4] = {{1, 0, -1, -2}, {-1, 2, 3, 0}};
+  const float input2_buffers[2][4] = {{1, -3, 2, -4}, {0, 1, -2, 1}};
+  float output_buffers[2][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {2, 4, 0, 6}};
+
+  onert::exec::Execution execution{executors};
+  for (auto run = 0; run < 4; run++)
+  {
+    const auto n = run % 2;
+    std::fill(std::begin(output_buffers[n]), std::end(output_buffers[n]), 0.0f);
+    execution.setInput(input1, reinterpret_cast<const void *>(input1_buffers[n]), 16);
+    execution.setInput(input2, reinterpret_cast<const void *>(input2_buffers[n]), 16);
+    execution.setOutput(output, reinterpret_cast<void *>(output_buffers[n]), 16);
+    execution.execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffers[n][i], output_expected[n][i]);
+      // The output of the other run is kept
+      if (run > 0)
+      {
+        EXPECT_EQ(output_buffers[1 - n][i], output_expected[1 - n][i]);
+      }
+    }
+  }
+
+  // An output buffer which is also an input buffer
+  float inout_buffer[4] = {1, 0, -1, -2};
+  execution.setInput(input1, reinterpret_cast<const void *>(inout_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffers[0]), 16);
+  execution.setOutput(output, reinterpret_cast<void *>(inout_buffer), 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(inout_buffer[i], output_expected[0][i]);
+  }
+}
+
+// Support executors compiled for changed input shapes
+TEST(ExecInstance, executorCache)
+{
+  auto mockup = CompiledMockUpModel();
+  auto graph = mockup.graph;
+  auto executors = mockup.executors;
+
+  auto factory = [&]() {
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    subgs->push(onert::ir::SubgraphIndex{0}, std::make_shared<Graph>(*graph));
+    return subgs;
+  };
+  auto options = onert::compiler::fetchCompilerOptionsFromGlobalConfig(*factory());
+  options.executor_cache_size = 1;
+  onert::compiler::ExecutorCache cache{factory, options, executors};
+
+  const Shape base_shape{1, 2, 2, 1};
+  const Shape batch2_shape{2, 2, 2, 1};
+  const Shape batch3_shape{3, 2, 2, 1};
+  EXPECT_EQ(cache.get({base_shape, base_shape}), executors);
+  EXPECT_EQ(cache.size(), 0u);
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[8] = {1, 0, -1, -2, 2, 1, -2, 0};
+  const float input2_buffer[8] = {1, -3, 2, -4, -3, 3, 1, 2};
+  float output_buffer[8] = {};
+  const float output_expected[8] = {5, -2, 0, -1, 2, 5, -2, 7};
+
+  onert::exec::Execution execution{executors};
+  execution.changeInputShape(input1, batch2_shape);
+  execution.changeInputShape(input2, batch2_shape);
+  EXPECT_TRUE(execution.isInputShapeChanged());
+
+  auto batch2_executors = cache.get({batch2_shape, batch2_shape});
+  EXPECT_NE(batch2_executors, executors);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.get({batch2_shape, batch2_shape}), batch2_executors);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Shapes are no longer changed from the static ones of the new executors
+  execution.setExecutors(batch2_executors);
+  EXPECT_FALSE(execution.isInputShapeChanged());
+  EXPECT_EQ(execution.getInputShape(input1), batch2_shape);
+
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 32);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 32);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 32);
+  execution.execute();
+
+  EXPECT_EQ(execution.getOutputShape(output), batch2_shape);
+  for (auto i = 0; i < 8; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  // Evicted executors are still valid while they are held
+  auto batch3_executors = cache.get({batch3_shape, batch3_shape});
+  EXPECT_EQ(cache.size(), 1u);
+  std::fill(output_buffer, output_buffer + 8, 0);
+  execution.execute();
+  for (auto i = 0; i < 8; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  // Executors of all the shapes refer to the constant data of the model, not to copies of it
+  const auto rhs2_data = graph->operands().at(OperandIndex{3}).shareData();
+  ASSERT_NE(rhs2_data, nullptr);
+  EXPECT_GE(rhs2_data.use_count(), 4);
+}
+
 } // namespace
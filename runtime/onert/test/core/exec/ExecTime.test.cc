@@ -100,4 +100,24 @@ TEST(ExecTime, structure)
   // clean up
   EXPECT_EQ(remove("exec_time.json"), 0);
 }
+
+TEST(ExecTime, snapshot)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  {
+    ExecTime et(bs);
+    et.updateOperationExecTime(b, "op1", true, 100, 100);
+
+    ExecTime snapshot(et);
+    et.updateOperationExecTime(b, "op1", true, 100, 300);
+    et.updateOperationExecTime(b, "op2", true, 100, 100);
+    ASSERT_EQ(et.getOperationExecTime(b, "op1", true, 100), 200);
+    ASSERT_EQ(snapshot.getOperationExecTime(b, "op1", true, 100), 100);
+    ASSERT_EQ(snapshot.getOperationExecTime(b, "op2", true, 100), ExecTime::NOT_FOUND);
+    et.storeOperationsExecTime();
+  }
+  // clean up
+  EXPECT_EQ(remove("exec_time.json"), 0);
+}
 } // unnamed namespace
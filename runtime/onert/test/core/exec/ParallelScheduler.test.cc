@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ParallelScheduler.h"
+#include "backend/IConfig.h"
+#include "backend/Backend.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+using namespace backend;
+
+struct MockConfig : public IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+private:
+  std::string _id;
+};
+
+struct MockBackend : public ::onert::backend::Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<onert::backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+private:
+  std::string _id;
+};
+
+class CountFunction : public IFunction
+{
+public:
+  CountFunction(std::atomic<uint32_t> &count, std::atomic<uint32_t> &running,
+                std::atomic<uint32_t> &max_running)
+    : _count{count}, _running{running}, _max_running{max_running}
+  {
+  }
+
+  void run() override
+  {
+    auto running = ++_running;
+    auto max_running = _max_running.load();
+    while (running > max_running && !_max_running.compare_exchange_weak(max_running, running))
+      ;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    --_running;
+    ++_count;
+  }
+
+private:
+  std::atomic<uint32_t> &_count;
+  std::atomic<uint32_t> &_running;
+  std::atomic<uint32_t> &_max_running;
+};
+
+TEST(ParallelScheduler, reuse_over_runs)
+{
+  MockBackend b1{"b1"};
+  MockBackend b2{"b2"};
+  BackendSet backends;
+  backends.add(&b1);
+  backends.add(&b2);
+
+  ParallelScheduler scheduler{backends};
+
+  std::atomic<uint32_t> count{0};
+  std::atomic<uint32_t> running{0};
+  std::atomic<uint32_t> max_running{0};
+  for (uint32_t run = 1; run <= 3; ++run)
+  {
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+      scheduler.assign(std::make_unique<CountFunction>(count, running, max_running),
+                       i % 2 ? &b1 : &b2);
+    }
+    scheduler.finish();
+    ASSERT_EQ(count.load(), run * 10);
+    ASSERT_EQ(running.load(), 0);
+  }
+  // One worker for each backend by default
+  ASSERT_LE(max_running.load(), 2);
+}
+
+TEST(ParallelScheduler, num_threads)
+{
+  MockBackend b1{"b1"};
+  BackendSet backends;
+  backends.add(&b1);
+
+  ParallelScheduler scheduler{backends, {{"b1", 4}}};
+
+  std::atomic<uint32_t> count{0};
+  std::atomic<uint32_t> running{0};
+  std::atomic<uint32_t> max_running{0};
+  for (uint32_t i = 0; i < 32; ++i)
+  {
+    scheduler.assign(std::make_unique<CountFunction>(count, running, max_running), &b1);
+  }
+  scheduler.finish();
+  ASSERT_EQ(count.load(), 32);
+  ASSERT_LE(max_running.load(), 4);
+}
+
+class RecordFunction : public IFunction
+{
+public:
+  RecordFunction(std::vector<int> &records, int id, std::shared_future<void> wait = {})
+    : _records{records}, _id{id}, _wait{wait}
+  {
+  }
+
+  void run() override
+  {
+    if (_wait.valid())
+      _wait.wait();
+    _records.push_back(_id);
+  }
+
+private:
+  std::vector<int> &_records;
+  int _id;
+  std::shared_future<void> _wait;
+};
+
+TEST(ParallelScheduler, priority)
+{
+  MockBackend b1{"b1"};
+  BackendSet backends;
+  backends.add(&b1);
+
+  ParallelScheduler scheduler{backends};
+
+  // Block the only worker until all the jobs are assigned
+  std::promise<void> start;
+  std::vector<int> records;
+  scheduler.assign(std::make_unique<RecordFunction>(records, 0, start.get_future().share()), &b1,
+                   100);
+  scheduler.assign(std::make_unique<RecordFunction>(records, 1), &b1, 1);
+  scheduler.assign(std::make_unique<RecordFunction>(records, 3), &b1, 3);
+  scheduler.assign(std::make_unique<RecordFunction>(records, 2), &b1, 2);
+  start.set_value();
+  scheduler.finish();
+
+  ASSERT_EQ(records, std::vector<int>({0, 3, 2, 1}));
+}
+
+TEST(ParallelScheduler, neg_finish_without_jobs)
+{
+  MockBackend b1{"b1"};
+  BackendSet backends;
+  backends.add(&b1);
+
+  ParallelScheduler scheduler{backends};
+  // Must not block
+  scheduler.finish();
+  SUCCEED();
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/BinaryArithmetic.h>
+#include <util/TracingCtx.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert;
+using namespace ir;
+
+// Model: output <= input + constant
+std::shared_ptr<Subgraphs> createAddConstModel(OperandIndex &constant)
+{
+  static float constant_data[4] = {1, 2, 3, 4};
+
+  auto graph = std::make_shared<Graph>();
+  TypeInfo type{DataType::FLOAT32};
+  auto input = graph->addOperand(Shape{1, 4}, type);
+  constant = graph->addOperand(Shape{1, 4}, type);
+  auto output = graph->addOperand(Shape{1, 4}, type);
+  graph->operands()
+    .at(constant)
+    .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(constant_data), 16));
+
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{input, constant}, OperandIndexSequence{output}, param));
+  graph->addInput(input);
+  graph->addOutput(output);
+  graph->verify();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  return subgs;
+}
+
+TEST(Subgraphs, clone_shares_constant_data)
+{
+  OperandIndex constant;
+  auto model = createAddConstModel(constant);
+  const auto data = model->primary()->operands().at(constant).shareData();
+
+  auto clone = model->clone();
+  ASSERT_NE(clone->primary(), model->primary());
+  ASSERT_EQ(clone->primary()->operands().size(), model->primary()->operands().size());
+  ASSERT_EQ(clone->primary()->operations().size(), model->primary()->operations().size());
+  ASSERT_EQ(clone->primary()->operands().at(constant).data(), data.get());
+}
+
+TEST(Subgraphs, compiled_clones_share_constant_data)
+{
+  OperandIndex constant;
+  auto model = createAddConstModel(constant);
+  const auto data = model->primary()->operands().at(constant).shareData();
+  const auto use_count = data.use_count();
+
+  // Compile two clones, as execution contexts of a session do
+  std::vector<std::unique_ptr<util::TracingCtx>> tracing_ctxs;
+  std::vector<std::shared_ptr<exec::ExecutorMap>> executors;
+  for (int i = 0; i < 2; ++i)
+  {
+    auto subgs = model->clone();
+    tracing_ctxs.emplace_back(std::make_unique<util::TracingCtx>(subgs.get()));
+    compiler::Compiler compiler{subgs, tracing_ctxs.back().get()};
+    compiler.options().backend_list = {"cpu"};
+    subgs.reset();
+    executors.emplace_back(compiler.compile());
+  }
+
+  // Each of the executors refers to the same constant data, not to a copy of it
+  ASSERT_GE(data.use_count(), use_count + 2);
+  for (auto &e : executors)
+  {
+    exec::Execution execution{e};
+    const float input_buffer[4] = {1, 1, 1, 1};
+    float output_buffer[4] = {};
+    execution.setInput(IOIndex{0}, input_buffer, sizeof(input_buffer));
+    execution.setOutput(IOIndex{0}, output_buffer, sizeof(output_buffer));
+    execution.execute();
+    ASSERT_EQ(output_buffer[0], 2);
+    ASSERT_EQ(output_buffer[3], 5);
+  }
+}
+
+} // namespace
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/Compiler.h"
+#include "util/CpuAffinity.h"
+
+#include <cstdlib>
+
+using namespace onert::util;
+
+TEST(CpuAffinity, parseCpuList)
+{
+  ASSERT_TRUE(parseCpuList("").empty());
+  ASSERT_EQ(parseCpuList("3"), (std::vector<uint32_t>{3}));
+  ASSERT_EQ(parseCpuList("0-3,6"), (std::vector<uint32_t>{0, 1, 2, 3, 6}));
+  ASSERT_EQ(parseCpuList("4,1-2,2"), (std::vector<uint32_t>{1, 2, 4}));
+}
+
+TEST(CpuAffinity, neg_parseCpuList)
+{
+  ASSERT_THROW(parseCpuList("a"), std::invalid_argument);
+  ASSERT_THROW(parseCpuList("1,"), std::invalid_argument);
+  ASSERT_THROW(parseCpuList(",1"), std::invalid_argument);
+  ASSERT_THROW(parseCpuList("3-1"), std::invalid_argument);
+  ASSERT_THROW(parseCpuList("-1"), std::invalid_argument);
+}
+
+TEST(CpuAffinity, splitCpuList)
+{
+  const std::vector<uint32_t> cpus{0, 1, 2, 4, 5};
+  ASSERT_TRUE(splitCpuList(cpus, 0).empty());
+  ASSERT_EQ(splitCpuList(cpus, 1), (std::vector<std::vector<uint32_t>>{cpus}));
+  ASSERT_EQ(splitCpuList(cpus, 2), (std::vector<std::vector<uint32_t>>{{0, 1}, {2, 4, 5}}));
+  // Every part runs on all the CPUs if there are not enough CPUs
+  ASSERT_EQ(splitCpuList({3, 7}, 3), (std::vector<std::vector<uint32_t>>{{3, 7}, {3, 7}, {3, 7}}));
+  ASSERT_EQ(splitCpuList({}, 2), (std::vector<std::vector<uint32_t>>{{}, {}}));
+}
+
+TEST(CpuAffinity, neg_malformedConfig)
+{
+  // A malformed list is ignored instead of failing the compilation
+  setenv("CPU_AFFINITY", "1,", true);
+  onert::ir::Subgraphs subgs;
+  onert::compiler::CompilerOptions options;
+  ASSERT_NO_THROW(options = onert::compiler::fetchCompilerOptionsFromGlobalConfig(subgs));
+  ASSERT_TRUE(options.cpu_affinity.empty());
+  unsetenv("CPU_AFFINITY");
+}
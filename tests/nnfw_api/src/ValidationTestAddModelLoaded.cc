@@ -28,6 +28,74 @@ TEST_F(ValidationTestAddModelLoaded, prepare_001)
   SUCCEED();
 }
 
+TEST_F(ValidationTestAddModelLoaded, run_with_cpu_threads)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_THREADS", "2"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_AFFINITY", "0"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  float input = 3.0f;
+  float output = 0.0f;
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &input, sizeof(input)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &output, sizeof(output)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(output, 5.0f);
+}
+
+TEST_F(ValidationTestAddModelLoaded, get_op_stats)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "OP_STATS", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  float input = 3.0f;
+  float output = 0.0f;
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &input, sizeof(input)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &output, sizeof(output)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  uint32_t count = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_get_op_stats(_session, nullptr, &count));
+  ASSERT_GE(count, 2); // At least the ADD and the subgraph
+
+  std::vector<nnfw_op_stats> stats(count);
+  NNFW_ENSURE_SUCCESS(nnfw_get_op_stats(_session, stats.data(), &count));
+  ASSERT_EQ(count, stats.size());
+  bool add_found = false;
+  for (const auto &stat : stats)
+  {
+    ASSERT_EQ(stat.count, 2);
+    ASSERT_LE(stat.p50_ns, stat.p99_ns);
+    ASSERT_LE(stat.p99_ns, stat.max_ns);
+    if (std::string{stat.name} == "Add")
+    {
+      add_found = true;
+      ASSERT_EQ(std::string{stat.backend}, "cpu");
+      ASSERT_EQ(stat.bytes, 2 * 3 * sizeof(float));
+    }
+  }
+  ASSERT_TRUE(add_found);
+  ASSERT_EQ(stats.back().op_index, UINT32_MAX);
+  ASSERT_EQ(std::string{stats.back().name}, "Subgraph");
+
+  NNFW_ENSURE_SUCCESS(nnfw_reset_op_stats(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_get_op_stats(_session, stats.data(), &count));
+  ASSERT_EQ(stats[0].count, 0);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_get_op_stats_disabled)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  uint32_t count = 0;
+  ASSERT_EQ(nnfw_get_op_stats(_session, nullptr, &count), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_get_op_stats(_session, nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 TEST_F(ValidationTestAddModelLoaded, set_available_backends_001)
 {
   NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
@@ -74,6 +142,14 @@ TEST_F(ValidationTestAddModelLoaded, neg_run)
   ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_INVALID_STATE);
 }
 
+TEST_F(ValidationTestAddModelLoaded, neg_create_execution_context)
+{
+  // nnfw_prepare is not called
+  nnfw_execution_context *context = nullptr;
+  ASSERT_EQ(nnfw_create_execution_context(_session, &context), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(context, nullptr);
+}
+
 TEST_F(ValidationTestAddModelLoaded, neg_set_input)
 {
   // nnfw_prepare is not called
@@ -208,6 +284,10 @@ TEST_F(ValidationTestAddModelLoaded, debug_set_config)
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "PROFILING_MODE", "1"));
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "DISABLE_COMPILE", "0"));
   NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "DISABLE_COMPILE", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_THREADS", "2"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_AFFINITY", "0"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_AFFINITY", "0-1,3"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "CPU_AFFINITY", ""));
   SUCCEED();
 }
 
@@ -220,6 +300,9 @@ TEST_F(ValidationTestAddModelLoaded, neg_debug_set_config)
   // wrong keys
   ASSERT_EQ(nnfw_set_config(_session, "", "1"), NNFW_STATUS_ERROR);
   ASSERT_EQ(nnfw_set_config(_session, "BAD_KEY", "1"), NNFW_STATUS_ERROR);
+
+  // wrong values
+  ASSERT_EQ(nnfw_set_config(_session, "CPU_AFFINITY", "1-0"), NNFW_STATUS_ERROR);
 }
 
 TEST_F(ValidationTestAddModelLoaded, debug_get_config)
@@ -17,6 +17,8 @@
 #include "fixtures.h"
 #include "NNPackages.h"
 
+#include <thread>
+
 using ValidationTestAddSessionPrepared = ValidationTestSessionPrepared<NNPackages::ADD>;
 
 TEST_F(ValidationTestAddSessionPrepared, run)
@@ -70,6 +72,75 @@ TEST_F(ValidationTestAddSessionPrepared, run_async)
   ASSERT_FLOAT_EQ(_output[0], 5.0);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, run_with_context)
+{
+  nnfw_execution_context *context = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(_session, &context));
+
+  float input = 3.0f;
+  float output = 0.0f;
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_input_with_context(context, 0, NNFW_TYPE_TENSOR_FLOAT32, &input, sizeof(input)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output_with_context(context, 0, NNFW_TYPE_TENSOR_FLOAT32, &output, sizeof(output)));
+  NNFW_ENSURE_SUCCESS(nnfw_run_with_context(context));
+  ASSERT_FLOAT_EQ(output, 5.0f);
+
+  NNFW_ENSURE_SUCCESS(nnfw_destroy_execution_context(context));
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_with_contexts_in_threads)
+{
+  constexpr int num_contexts = 4;
+  constexpr int num_runs = 16;
+
+  std::vector<nnfw_execution_context *> contexts(num_contexts, nullptr);
+  for (auto &context : contexts)
+    NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(_session, &context));
+
+  std::vector<NNFW_STATUS> results(num_contexts, NNFW_STATUS_NO_ERROR);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_contexts; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < num_runs && results[t] == NNFW_STATUS_NO_ERROR; ++i)
+      {
+        float input = static_cast<float>(t * num_runs + i);
+        float output = 0.0f;
+        nnfw_set_input_with_context(contexts[t], 0, NNFW_TYPE_TENSOR_FLOAT32, &input,
+                                    sizeof(input));
+        nnfw_set_output_with_context(contexts[t], 0, NNFW_TYPE_TENSOR_FLOAT32, &output,
+                                     sizeof(output));
+        results[t] = nnfw_run_with_context(contexts[t]);
+        if (output != input + 2.0f)
+          results[t] = NNFW_STATUS_ERROR;
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t = 0; t < num_contexts; ++t)
+    ASSERT_EQ(results[t], NNFW_STATUS_NO_ERROR) << "context : " << t;
+
+  // The session itself is still usable
+  SetInOutBuffers();
+  _input[0] = 3.0;
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+
+  for (auto context : contexts)
+    NNFW_ENSURE_SUCCESS(nnfw_destroy_execution_context(context));
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_create_execution_context)
+{
+  ASSERT_EQ(nnfw_create_execution_context(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  nnfw_execution_context *context = nullptr;
+  ASSERT_EQ(nnfw_create_execution_context(nullptr, &context), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_run_with_context(nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_input_001)
 {
   char input[32];
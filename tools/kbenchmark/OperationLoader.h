@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 #include "Operation.h"
+#include "operations/BatchMatMul.h"
 #include "operations/Convolution.h"
 #include "operations/TransposeConv.h"
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchMatMul benchmark of cker reference and ruy kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using nnfw::cker::Shape;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LHS_BATCH, 1);
+NONIUS_PARAM(LHS_H, 128);
+NONIUS_PARAM(LHS_W, 64);
+
+NONIUS_PARAM(RHS_BATCH, 1);
+NONIUS_PARAM(RHS_H, 64);
+NONIUS_PARAM(RHS_W, 128);
+
+NONIUS_PARAM(ADJ_X, 0);
+NONIUS_PARAM(ADJ_Y, 0);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape lhs_shape;
+  Shape rhs_shape;
+  Shape output_shape;
+
+  bool adj_x;
+  bool adj_y;
+
+  // Batch dimensions of lhs and rhs are flattened, so they are broadcastable only if one is 1
+  bool valid;
+
+  Configuration(nonius::chronometer meter)
+  {
+    const int lhs_batch = meter.param<LHS_BATCH>();
+    const int rhs_batch = meter.param<RHS_BATCH>();
+    lhs_shape = Shape{lhs_batch, meter.param<LHS_H>(), meter.param<LHS_W>()};
+    rhs_shape = Shape{rhs_batch, meter.param<RHS_H>(), meter.param<RHS_W>()};
+    adj_x = meter.param<ADJ_X>() != 0;
+    adj_y = meter.param<ADJ_Y>() != 0;
+
+    const int m = adj_x ? lhs_shape.Dims(2) : lhs_shape.Dims(1);
+    const int k = adj_x ? lhs_shape.Dims(1) : lhs_shape.Dims(2);
+    const int n = adj_y ? rhs_shape.Dims(1) : rhs_shape.Dims(2);
+    const int rhs_k = adj_y ? rhs_shape.Dims(2) : rhs_shape.Dims(1);
+    output_shape = Shape{std::max(lhs_batch, rhs_batch), m, n};
+
+    valid = (k == rhs_k) && (lhs_batch == rhs_batch || lhs_batch == 1 || rhs_batch == 1);
+  }
+};
+
+void skip(nonius::chronometer meter)
+{
+  meter.measure([&](int) {
+    // DO NOTHING
+    volatile int x = 0;
+    return x;
+  });
+}
+
+void run_ruy(nonius::chronometer meter, int num_threads)
+{
+  Configuration p{meter};
+  if (!p.valid)
+  {
+    skip(meter);
+    return;
+  }
+
+  std::vector<float> lhs(p.lhs_shape.FlatSize(), 1.f);
+  std::vector<float> rhs(p.rhs_shape.FlatSize(), 1.f);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+  nnfw::cker::BatchMatMul kernel;
+
+  // Run!
+  meter.measure([&](int) {
+    kernel(p.lhs_shape, lhs.data(), p.rhs_shape, rhs.data(), p.adj_x, p.adj_y, p.output_shape,
+           output.data(), &ruy_context);
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerBatchMatMul_Reference", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  if (!p.valid)
+  {
+    skip(meter);
+    return;
+  }
+
+  std::vector<float> lhs(p.lhs_shape.FlatSize(), 1.f);
+  std::vector<float> rhs(p.rhs_shape.FlatSize(), 1.f);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(p.lhs_shape, p.rhs_shape, p.adj_x, p.adj_y);
+
+  // Run!
+  meter.measure([&](int) {
+    kernel(p.lhs_shape, lhs.data(), p.rhs_shape, rhs.data(), p.adj_x, p.adj_y, p.output_shape,
+           output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerBatchMatMul_Ruy_SingleThread",
+                       [](nonius::chronometer meter) { run_ruy(meter, 1); })
+
+NONIUS_LOCAL_BENCHMARK("CkerBatchMatMul_Ruy_MultiThread", [](nonius::chronometer meter) {
+  run_ruy(meter, std::max(1u, std::thread::hardware_concurrency()));
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
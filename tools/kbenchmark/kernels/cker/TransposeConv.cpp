@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TransposeConv benchmark of cker reference scatter and GEMM + col2im kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/TransposeConv.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeConvParams;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ker_shape;
+  Shape ofm_shape;
+
+  TransposeConvParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    const int batch = meter.param<BATCH>();
+    const int ifm_C = meter.param<IFM_C>();
+    const int ifm_H = meter.param<IFM_H>();
+    const int ifm_W = meter.param<IFM_W>();
+    const int ofm_C = meter.param<OFM_C>();
+    const int ofm_H = meter.param<OFM_H>();
+    const int ofm_W = meter.param<OFM_W>();
+    const int ker_H = meter.param<KER_H>();
+    const int ker_W = meter.param<KER_W>();
+
+    ifm_shape = Shape{batch, ifm_H, ifm_W, ifm_C};
+    ker_shape = Shape{ofm_C, ker_H, ker_W, ifm_C};
+    ofm_shape = Shape{batch, ofm_H, ofm_W, ofm_C};
+
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    params.dilation_height_factor = 1;
+    params.dilation_width_factor = 1;
+
+    // NOTE The padding calculation formula of TransposeConv is opposite to Conv.
+    //      So the location of ifm and ofm is changed.
+    params.padding_values.height = 0;
+    params.padding_values.width = 0;
+    if (meter.param<PADDING>() == "SAME")
+    {
+      const int vertical_needed = (ifm_H - 1) * params.stride_height + ker_H;
+      const int horizontal_needed = (ifm_W - 1) * params.stride_width + ker_W;
+      params.padding_values.height = std::max(0, vertical_needed - ofm_H) / 2;
+      params.padding_values.width = std::max(0, horizontal_needed - ofm_W) / 2;
+    }
+
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+  }
+};
+
+void run_gemm(nonius::chronometer meter, int num_threads)
+{
+  Configuration p{meter};
+
+  std::vector<float> ifm(p.ifm_shape.FlatSize(), 1.f);
+  std::vector<float> ker(p.ker_shape.FlatSize(), 1.f);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+  std::vector<float> col2im(
+    nnfw::cker::optimized::TransposeConvCol2imSize(p.ifm_shape, p.ker_shape));
+
+  std::vector<float> hwoi_ker(ker.size());
+  nnfw::cker::optimized::TransposeConvFilterToHWOI(p.ker_shape, ker.data(), hwoi_ker.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(num_threads);
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::cker::optimized::TransposeConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape,
+                                         hwoi_ker.data(), true, p.ofm_shape, ofm.data(),
+                                         col2im.data(), &ruy_context);
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerTransposeConv_Reference", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> ifm(p.ifm_shape.FlatSize(), 1.f);
+  std::vector<float> ker(p.ker_shape.FlatSize(), 1.f);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::cker::TransposeConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(),
+                              p.ofm_shape, ofm.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerTransposeConv_Gemm_SingleThread",
+                       [](nonius::chronometer meter) { run_gemm(meter, 1); })
+
+NONIUS_LOCAL_BENCHMARK("CkerTransposeConv_Gemm_MultiThread", [](nonius::chronometer meter) {
+  run_gemm(meter, std::max(1u, std::thread::hardware_concurrency()));
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+#define __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class BatchMatMul final : public Operation
+{
+public:
+  BatchMatMul() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Batch dimensions are flattened
+    auto flat_batch = [](const std::vector<int> &dims) {
+      int batch = 1;
+      for (size_t i = 0; i + 2 < dims.size(); ++i)
+        batch *= dims[i];
+      return batch;
+    };
+
+    auto _lhs = get_key_dims({"input0"}, info);
+    params.insert({"LHS_BATCH", nonius::param{flat_batch(_lhs)}});
+    params.insert({"LHS_H", nonius::param{_lhs[_lhs.size() - 2]}});
+    params.insert({"LHS_W", nonius::param{_lhs[_lhs.size() - 1]}});
+
+    auto _rhs = get_key_dims({"input1"}, info);
+    params.insert({"RHS_BATCH", nonius::param{flat_batch(_rhs)}});
+    params.insert({"RHS_H", nonius::param{_rhs[_rhs.size() - 2]}});
+    params.insert({"RHS_W", nonius::param{_rhs[_rhs.size() - 1]}});
+
+    auto _adj_x = get_key_int({"adj_x"}, info);
+    auto _adj_y = get_key_int({"adj_y"}, info);
+    params.insert({"ADJ_X", nonius::param{_adj_x}});
+    params.insert({"ADJ_Y", nonius::param{_adj_y}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
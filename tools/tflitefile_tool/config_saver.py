@@ -126,5 +126,8 @@ class ConfigSaver(object):
             self.SavePadding()
             self.f.write("depthmultiplier: {}\n".format(
                 self.operator.options.DepthMultiplier()))
+        elif self.op_name == 'BATCH_MATMUL':
+            self.f.write("adj_x: {}\n".format(int(self.operator.options.AdjointLhs())))
+            self.f.write("adj_y: {}\n".format(int(self.operator.options.AdjointRhs())))
 
         self.SaveFusedAct()